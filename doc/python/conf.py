@@ -14,6 +14,7 @@ import corrade.pluginmanager
 import corrade.utility
 
 import magnum
+import magnum.debugtools
 import magnum.gl
 import magnum.materialtools
 import magnum.meshtools
@@ -32,7 +33,7 @@ import magnum.trade
 # So the doc see everything
 # TODO: use just +=, m.css should reorder this on its own
 corrade.__all__ = ['containers', 'pluginmanager', 'utility', 'BUILD_DEPRECATED', 'BUILD_STATIC', 'BUILD_MULTITHREADED', 'TARGET_UNIX', 'TARGET_APPLE', 'TARGET_IOS', 'TARGET_IOS_SIMULATOR', 'TARGET_WINDOWS', 'TARGET_WINDOWS_RT', 'TARGET_EMSCRIPTEN', 'TARGET_ANDROID']
-magnum.__all__ = ['math', 'gl', 'materialtools', 'meshtools', 'platform', 'primitives', 'shaders', 'scenegraph', 'scenetools', 'text', 'trade', 'BUILD_DEPRECATED', 'BUILD_STATIC', 'TARGET_GL', 'TARGET_GLES', 'TARGET_GLES2', 'TARGET_WEBGL', 'TARGET_EGL', 'TARGET_VK'] + magnum.__all__
+magnum.__all__ = ['math', 'animation', 'debugtools', 'gl', 'materialtools', 'meshtools', 'platform', 'primitives', 'shaders', 'scenegraph', 'scenetools', 'text', 'trade', 'BUILD_DEPRECATED', 'BUILD_STATIC', 'TARGET_GL', 'TARGET_GLES', 'TARGET_GLES2', 'TARGET_WEBGL', 'TARGET_EGL', 'TARGET_VK'] + magnum.__all__
 
 # hide values of the preprocessor defines to avoid confusion by assigning a
 # class without __repr__ to them
@@ -205,6 +206,8 @@ INPUT_DOCS = [
     'corrade.utility.rst',
 
     'magnum.rst',
+    'magnum.animation.rst',
+    'magnum.debugtools.rst',
     'magnum.gl.rst',
     'magnum.math.rst',
     'magnum.materialtools.rst',
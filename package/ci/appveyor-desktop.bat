@@ -57,7 +57,7 @@ cmake .. ^
     -DCMAKE_PREFIX_PATH=%APPVEYOR_BUILD_FOLDER%/SDL ^
     -DMAGNUM_BUILD_STATIC=%BUILD_STATIC% %STATIC_PLUGIN_PATH% ^
     -DMAGNUM_WITH_AUDIO=OFF ^
-    -DMAGNUM_WITH_DEBUGTOOLS=OFF ^
+    -DMAGNUM_WITH_DEBUGTOOLS=ON ^
     -DMAGNUM_WITH_GL=ON ^
     -DMAGNUM_WITH_MATERIALTOOLS=ON ^
     -DMAGNUM_WITH_MESHTOOLS=ON ^
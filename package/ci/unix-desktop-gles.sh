@@ -28,7 +28,7 @@ cmake .. \
     -DMAGNUM_TARGET_GLES=ON \
     -DMAGNUM_TARGET_GLES2=$TARGET_GLES2 \
     -DMAGNUM_WITH_AUDIO=OFF \
-    -DMAGNUM_WITH_DEBUGTOOLS=OFF \
+    -DMAGNUM_WITH_DEBUGTOOLS=ON \
     -DMAGNUM_WITH_GL=ON \
     -DMAGNUM_WITH_MATERIALTOOLS=ON \
     -DMAGNUM_WITH_MESHTOOLS=ON \
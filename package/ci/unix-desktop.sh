@@ -29,7 +29,7 @@ cmake .. \
     -DMAGNUM_BUILD_DEPRECATED=$BUILD_DEPRECATED \
     -DMAGNUM_BUILD_STATIC=$BUILD_STATIC \
     -DMAGNUM_WITH_AUDIO=OFF \
-    -DMAGNUM_WITH_DEBUGTOOLS=OFF \
+    -DMAGNUM_WITH_DEBUGTOOLS=ON \
     -DMAGNUM_WITH_GL=ON \
     -DMAGNUM_WITH_MATERIALTOOLS=ON \
     -DMAGNUM_WITH_MESHTOOLS=ON \
@@ -0,0 +1,82 @@
+#ifndef Corrade_Containers_ArrayPythonBindings_h
+#define Corrade_Containers_ArrayPythonBindings_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <pybind11/pybind11.h>
+#include <Corrade/Containers/Array.h>
+
+#include "Corrade/Containers/PythonBindings.h"
+#include "Corrade/Containers/StridedArrayViewPythonBindings.h"
+
+namespace Corrade { namespace Containers {
+
+/* Moves an array into an opaque Python object owning its memory. The data
+   pointer doesn't change with the move, so views created on the array
+   before can have the returned object as their owner. */
+template<class T, class D> pybind11::capsule pyArrayOwner(Array<T, D>&& array) {
+    return pybind11::capsule{new Array<T, D>{std::move(array)}, [](void* data) {
+        delete static_cast<Array<T, D>*>(data);
+    }};
+}
+
+/* Moves an array into a Python object owning its memory and returns a view
+   on it with a format string and item accessors derived from the type */
+template<class T> PyArrayViewHolder<PyStridedArrayView<1, char>> pyOwnedArrayView(Array<T>&& array) {
+    const StridedArrayView1D<T> view = array;
+    return pyArrayViewHolder(PyStridedArrayView<1, char>{view}, pyArrayOwner(std::move(array)));
+}
+
+/* Variant with an explicit format string and item accessors, for types that
+   don't have a Python equivalent such as a pair of integers */
+template<class T> PyArrayViewHolder<PyStridedArrayView<1, char>> pyOwnedArrayView(Array<T>&& array, Containers::StringView format, pybind11::object(*getitem)(const char*), void(*setitem)(char*, pybind11::handle)) {
+    const StridedArrayView1D<char> view = arrayCast<char>(StridedArrayView1D<T>{array});
+    return pyArrayViewHolder(PyStridedArrayView<1, char>{view, format, sizeof(T), getitem, setitem}, pyArrayOwner(std::move(array)));
+}
+
+}}
+
+namespace pybind11 { namespace detail {
+
+/* Returning an array of scalar types from a binding moves it into a Python
+   object owning the memory, exposed as a containers.MutableStridedArrayView1D
+   instead of converting each element to a Python object. Conversion in the
+   other direction isn't implemented, use a view on a buffer there. */
+template<class T> struct type_caster<Corrade::Containers::Array<T>, enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>> {
+    static handle cast(Corrade::Containers::Array<T>&& src, return_value_policy, handle) {
+        return pybind11::cast(Corrade::Containers::pyOwnedArrayView(std::move(src))).release();
+    }
+
+    bool load(handle, bool) {
+        return false;
+    }
+
+    PYBIND11_TYPE_CASTER(Corrade::Containers::Array<T>, _("corrade.containers.MutableStridedArrayView1D"));
+};
+
+}}
+
+#endif
@@ -59,6 +59,19 @@ template<class T> struct PyPluginHolder: std::unique_ptr<T> {
     }
 
     pybind11::object manager;
+
+    /* Owner of external memory the plugin instance currently operates on, if
+       any, such as a memory-mapped file an importer is opened on, or a null
+       object. Data returned by the plugin that reference the memory get it
+       as their owner. */
+    pybind11::object memoryOwner;
+
+    /* Set while the plugin instance is used with the GIL released. Plugins
+       aren't thread-safe, so bindings that release the GIL set this and
+       bindings check it to fail with an exception instead of racing on the
+       instance from another Python thread. Only ever accessed with the GIL
+       held, thus doesn't need to be atomic. */
+    bool busy{};
 };
 
 template<class T> PyPluginHolder<T> pyPluginHolder(Containers::Pointer<T>&& plugin, pybind11::object owner) {
@@ -0,0 +1,96 @@
+#ifndef corrade_DLPack_h
+#define corrade_DLPack_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+
+namespace corrade {
+
+/* ABI-compatible subset of dlpack.h (https://github.com/dmlc/dlpack), which
+   is a single header with a stable ABI. Redefining the few structs here
+   instead of pulling in another dependency. Both the legacy unversioned
+   DLManagedTensor and the 1.0 DLManagedTensorVersioned are needed, as the
+   producer picks one based on what the consumer asks for. */
+
+enum: std::int32_t {
+    DLDeviceTypeCpu = 1
+};
+
+enum: std::uint8_t {
+    DLDataTypeCodeInt = 0,
+    DLDataTypeCodeUInt = 1,
+    DLDataTypeCodeFloat = 2,
+    DLDataTypeCodeBool = 6
+};
+
+enum: std::uint64_t {
+    DLFlagReadOnly = 1 << 0
+};
+
+struct DLDevice {
+    std::int32_t deviceType;
+    std::int32_t deviceId;
+};
+
+struct DLDataType {
+    std::uint8_t code;
+    std::uint8_t bits;
+    std::uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    std::int32_t ndim;
+    DLDataType dtype;
+    std::int64_t* shape;
+    std::int64_t* strides;
+    std::uint64_t byteOffset;
+};
+
+struct DLManagedTensor {
+    DLTensor tensor;
+    void* managerContext;
+    void(*deleter)(DLManagedTensor*);
+};
+
+struct DLPackVersion {
+    std::uint32_t major;
+    std::uint32_t minor;
+};
+
+struct DLManagedTensorVersioned {
+    DLPackVersion version;
+    void* managerContext;
+    void(*deleter)(DLManagedTensorVersioned*);
+    std::uint64_t flags;
+    DLTensor tensor;
+};
+
+}
+
+#endif
@@ -30,11 +30,13 @@
 #include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/ScopeGuard.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Corrade/Containers/PythonBindings.h"
 #include "Corrade/Containers/StridedArrayViewPythonBindings.h"
 
 #include "corrade/bootstrap.h"
+#include "corrade/DLPack.h"
 #include "corrade/PyBuffer.h"
 
 namespace corrade {
@@ -309,6 +311,75 @@ template<> Containers::Array<char> bytes(Containers::StridedArrayView<4, const c
     return out;
 }
 
+/* Contiguous copy of whole items, as opposed to bytes() above which takes
+   just the first byte of each */
+template<unsigned dimensions> std::size_t contiguousSize(const Containers::StridedArrayView<dimensions, const char>& view, std::size_t itemsize) {
+    const Containers::Size<dimensions> viewSize{view.size()};
+    std::size_t size = itemsize;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        size *= viewSize[i];
+    return size;
+}
+template<unsigned dimensions> void copyContiguous(const Containers::StridedArrayView<dimensions, const char>& view, std::size_t itemsize, char* const out) {
+    const Containers::StridedArrayView<dimensions + 1, const char> src = Containers::arrayCast<dimensions + 1, const char>(Containers::StridedArrayView<dimensions, const void>{view}, itemsize);
+    Utility::copy(src, Containers::StridedArrayView<dimensions + 1, char>{Containers::arrayView(out, contiguousSize(view, itemsize)), src.size()});
+}
+
+/* Conversion of the common scalar types to Python objects for tolist(),
+   bypassing the py::cast() in the getitem accessor */
+typedef PyObject*(*ItemToPython)(const char*);
+template<class T> PyObject* signedItemToPython(const char* const item) {
+    return PyLong_FromLongLong(*reinterpret_cast<const T*>(item));
+}
+template<class T> PyObject* unsignedItemToPython(const char* const item) {
+    return PyLong_FromUnsignedLongLong(*reinterpret_cast<const T*>(item));
+}
+template<class T> PyObject* floatItemToPython(const char* const item) {
+    return PyFloat_FromDouble(*reinterpret_cast<const T*>(item));
+}
+
+ItemToPython itemToPythonForFormat(const char* const format, const std::size_t itemsize) {
+    /* The format string can be null, in which case B should be assumed,
+       same as in accessorsForFormat() below */
+    const Containers::StringView formatString = format ? format : "B"_s;
+
+    #define _c(string, type, function)                                      \
+        if(formatString == #string ## _s && itemsize == sizeof(type))       \
+            return function<type>;
+    _c(b, std::int8_t, signedItemToPython)
+    _c(B, std::uint8_t, unsignedItemToPython)
+    _c(h, std::int16_t, signedItemToPython)
+    _c(H, std::uint16_t, unsignedItemToPython)
+    _c(i, std::int32_t, signedItemToPython)
+    _c(I, std::uint32_t, unsignedItemToPython)
+    _c(q, std::int64_t, signedItemToPython)
+    _c(Q, std::uint64_t, unsignedItemToPython)
+    _c(f, float, floatItemToPython)
+    _c(d, double, floatItemToPython)
+    #undef _c
+
+    return nullptr;
+}
+
+/* If convert is null, the generic getitem is used. The 1D variant has to be
+   before the templated one so it gets picked for the innermost dimension. */
+py::list stridedArrayViewToList(const Containers::StridedArrayView1D<const char>& view, const ItemToPython convert, py::object(*const getitem)(const char*)) {
+    py::list out{view.size()};
+    for(std::size_t i = 0; i != view.size(); ++i) {
+        PyObject* const item = convert ? convert(&view[i]) : getitem(&view[i]).release().ptr();
+        if(!item)
+            throw py::error_already_set{};
+        PyList_SET_ITEM(out.ptr(), i, item);
+    }
+    return out;
+}
+template<unsigned dimensions> py::list stridedArrayViewToList(const Containers::StridedArrayView<dimensions, const char>& view, const ItemToPython convert, py::object(*const getitem)(const char*)) {
+    py::list out{view.size()[0]};
+    for(std::size_t i = 0; i != view.size()[0]; ++i)
+        PyList_SET_ITEM(out.ptr(), i, stridedArrayViewToList(Containers::StridedArrayView<dimensions - 1, const char>{view[i]}, convert, getitem).release().ptr());
+    return out;
+}
+
 /* Getting a runtime tuple index. Ugh. */
 template<class T> const T& dimensionsTupleGet(const typename DimensionsTuple<1, T>::Type& tuple, std::size_t i) {
     if(i == 0)
@@ -612,6 +683,254 @@ Containers::Pair<py::object(*)(const char*), void(*)(char*, py::handle)> accesso
         }};
 }
 
+/* Maps a format string to a DLPack data type. Formats with a repeat count
+   such as "3f" or "fff" are exposed with the count as an additional innermost
+   dimension. Returns the count or 0 if the format isn't representable. */
+std::size_t dlpackTypeForFormat(const char* const format, const std::size_t itemsize, DLDataType& type) {
+    /* The format string can be null, in which case B should be assumed,
+       same as in accessorsForFormat() */
+    Containers::StringView formatString = format ? format : "B"_s;
+
+    std::size_t count = 0;
+    while(!formatString.isEmpty() && formatString.front() >= '0' && formatString.front() <= '9') {
+        count = count*10 + (formatString.front() - '0');
+        formatString = formatString.exceptPrefix(1);
+    }
+    if(formatString.isEmpty())
+        return 0;
+    if(!count) {
+        for(const char c: formatString)
+            if(c != formatString.front()) return 0;
+        count = formatString.size();
+    } else if(formatString.size() != 1)
+        return 0;
+
+    switch(formatString.front()) {
+        #define _c(string, code_, type_)                                     \
+            case string:                                                    \
+                type = DLDataType{code_, sizeof(type_)*8, 1};               \
+                return count*sizeof(type_) == itemsize ? count : 0;
+        _c('b', DLDataTypeCodeInt, std::int8_t)
+        _c('B', DLDataTypeCodeUInt, std::uint8_t)
+        _c('h', DLDataTypeCodeInt, std::int16_t)
+        _c('H', DLDataTypeCodeUInt, std::uint16_t)
+        _c('i', DLDataTypeCodeInt, std::int32_t)
+        _c('I', DLDataTypeCodeUInt, std::uint32_t)
+        _c('q', DLDataTypeCodeInt, std::int64_t)
+        _c('Q', DLDataTypeCodeUInt, std::uint64_t)
+        _c('e', DLDataTypeCodeFloat, std::uint16_t)
+        _c('f', DLDataTypeCodeFloat, float)
+        _c('d', DLDataTypeCodeFloat, double)
+        _c('?', DLDataTypeCodeBool, bool)
+        #undef _c
+    }
+
+    return 0;
+}
+
+/* The inverse of the above, returns null if the type isn't representable */
+const char* formatForDLPackType(const DLDataType& type) {
+    if(type.lanes != 1)
+        return nullptr;
+
+    #define _c(code_, bits_, string)                                        \
+        if(type.code == code_ && type.bits == bits_) return string;
+    _c(DLDataTypeCodeInt, 8, "b")
+    _c(DLDataTypeCodeUInt, 8, "B")
+    _c(DLDataTypeCodeInt, 16, "h")
+    _c(DLDataTypeCodeUInt, 16, "H")
+    _c(DLDataTypeCodeInt, 32, "i")
+    _c(DLDataTypeCodeUInt, 32, "I")
+    _c(DLDataTypeCodeInt, 64, "q")
+    _c(DLDataTypeCodeUInt, 64, "Q")
+    _c(DLDataTypeCodeFloat, 16, "e")
+    _c(DLDataTypeCodeFloat, 32, "f")
+    _c(DLDataTypeCodeFloat, 64, "d")
+    _c(DLDataTypeCodeBool, 8, "?")
+    #undef _c
+
+    return nullptr;
+}
+
+/* The legacy and the versioned capsule differ only in the name and the
+   read-only flag */
+template<class> struct DLPackTraits;
+template<> struct DLPackTraits<DLManagedTensor> {
+    static const char* name() { return "dltensor"; }
+    static const char* usedName() { return "used_dltensor"; }
+    static void setup(DLManagedTensor&, bool) {}
+    static bool isReadOnly(const DLManagedTensor&) { return false; }
+};
+template<> struct DLPackTraits<DLManagedTensorVersioned> {
+    static const char* name() { return "dltensor_versioned"; }
+    static const char* usedName() { return "used_dltensor_versioned"; }
+    static void setup(DLManagedTensorVersioned& managed, bool readOnly) {
+        managed.version = {1, 0};
+        managed.flags = readOnly ? DLFlagReadOnly : 0;
+    }
+    static bool isReadOnly(const DLManagedTensorVersioned& managed) {
+        return managed.flags & DLFlagReadOnly;
+    }
+};
+
+/* Exported tensor together with its shape and stride storage and a reference
+   to the memory owner, keeping it alive until the consumer is done with it */
+template<class Managed> struct DLPackExport {
+    Managed managed;
+    std::int64_t shape[5];
+    std::int64_t strides[5];
+    PyObject* owner;
+};
+
+template<class Managed> void dlpackExportDeleter(Managed* const managed) {
+    DLPackExport<Managed>* const data = static_cast<DLPackExport<Managed>*>(managed->managerContext);
+    /* The consumer can call this from any thread */
+    const PyGILState_STATE state = PyGILState_Ensure();
+    Py_XDECREF(data->owner);
+    PyGILState_Release(state);
+    delete data;
+}
+
+/* If the capsule got renamed, it was consumed and the consumer is
+   responsible for calling the deleter */
+template<class Managed> void dlpackCapsuleDestructor(PyObject* const capsule) {
+    if(!PyCapsule_IsValid(capsule, DLPackTraits<Managed>::name()))
+        return;
+    Managed* const managed = static_cast<Managed*>(PyCapsule_GetPointer(capsule, DLPackTraits<Managed>::name()));
+    if(managed->deleter)
+        managed->deleter(managed);
+}
+
+/* Destructor of the capsule used as an owner of a view created from a
+   consumed tensor */
+template<class Managed> void dlpackOwnerDestructor(PyObject* const capsule) {
+    Managed* const managed = static_cast<Managed*>(PyCapsule_GetPointer(capsule, nullptr));
+    if(managed->deleter)
+        managed->deleter(managed);
+}
+
+template<class Managed, unsigned dimensions, class T> py::object dlpackExport(const Containers::PyStridedArrayView<dimensions, T>& self, py::handle owner) {
+    DLDataType type;
+    const std::size_t count = dlpackTypeForFormat(self.format ? self.format.data() : nullptr, self.itemsize, type);
+    if(!count) {
+        PyErr_Format(PyExc_BufferError, "format %s with %zu bytes can't be represented in DLPack", self.format ? self.format.data() : "B", self.itemsize);
+        throw py::error_already_set{};
+    }
+
+    /* Calculate everything before allocating so there's nothing to clean up
+       on error */
+    const std::size_t typeSize = type.bits/8;
+    const Containers::Size<dimensions> size = self.size();
+    const Containers::Stride<dimensions> stride = self.stride();
+    for(std::size_t i = 0; i != dimensions; ++i) if(stride[i] % std::ptrdiff_t(typeSize)) {
+        PyErr_Format(PyExc_BufferError, "stride of %zi bytes in dimension %zu is not a multiple of %zu-byte %s", stride[i], i, typeSize, formatForDLPackType(type));
+        throw py::error_already_set{};
+    }
+
+    DLPackExport<Managed>* const data = new DLPackExport<Managed>{};
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        data->shape[i] = size[i];
+        data->strides[i] = stride[i]/std::ptrdiff_t(typeSize);
+    }
+    /* Multi-component items are an additional contiguous dimension */
+    const std::size_t ndim = dimensions + (count == 1 ? 0 : 1);
+    if(count != 1) {
+        data->shape[dimensions] = count;
+        data->strides[dimensions] = 1;
+    }
+
+    data->managed.tensor.data = const_cast<typename std::remove_const<T>::type*>(static_cast<T*>(self.data()));
+    data->managed.tensor.device = DLDevice{DLDeviceTypeCpu, 0};
+    data->managed.tensor.ndim = ndim;
+    data->managed.tensor.dtype = type;
+    data->managed.tensor.shape = data->shape;
+    data->managed.tensor.strides = data->strides;
+    data->managed.tensor.byteOffset = 0;
+    data->managed.managerContext = data;
+    data->managed.deleter = dlpackExportDeleter<Managed>;
+    DLPackTraits<Managed>::setup(data->managed, std::is_const<T>::value);
+    data->owner = owner.inc_ref().ptr();
+
+    PyObject* const capsule = PyCapsule_New(&data->managed, DLPackTraits<Managed>::name(), dlpackCapsuleDestructor<Managed>);
+    if(!capsule) {
+        dlpackExportDeleter(&data->managed);
+        throw py::error_already_set{};
+    }
+    return py::reinterpret_steal<py::object>(capsule);
+}
+
+template<class Managed, unsigned dimensions, class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<dimensions, T>> dlpackImport(py::handle capsule) {
+    Managed* const managed = static_cast<Managed*>(PyCapsule_GetPointer(capsule.ptr(), DLPackTraits<Managed>::name()));
+    if(!managed)
+        throw py::error_already_set{};
+
+    /* If any of these fail, the capsule stays unconsumed and its destructor
+       calls the deleter */
+    const DLTensor& tensor = managed->tensor;
+    if(tensor.device.deviceType != DLDeviceTypeCpu) {
+        PyErr_Format(PyExc_BufferError, "expected a CPU tensor but got device type %i", tensor.device.deviceType);
+        throw py::error_already_set{};
+    }
+    if(tensor.ndim != dimensions) {
+        PyErr_Format(PyExc_BufferError, "expected %u dimensions but got %i", dimensions, tensor.ndim);
+        throw py::error_already_set{};
+    }
+    const char* const format = formatForDLPackType(tensor.dtype);
+    if(!format) {
+        PyErr_Format(PyExc_BufferError, "unsupported DLPack data type with code %u, %u bits and %u lanes", unsigned(tensor.dtype.code), unsigned(tensor.dtype.bits), unsigned(tensor.dtype.lanes));
+        throw py::error_already_set{};
+    }
+    if(!std::is_const<T>::value && DLPackTraits<Managed>::isReadOnly(*managed)) {
+        PyErr_SetString(PyExc_BufferError, "tensor is read-only");
+        throw py::error_already_set{};
+    }
+
+    /* Strides are in elements, null means a row-major contiguous layout.
+       Calculate also the memory range spanned by the view, which is needed
+       for the view constructor and can start before the first element if
+       there are negative strides. */
+    const std::size_t typeSize = tensor.dtype.bits/8;
+    Containers::Size<dimensions> size{NoInit};
+    Containers::Stride<dimensions> stride{NoInit};
+    std::ptrdiff_t contiguousStride = typeSize;
+    std::ptrdiff_t min = 0, max = typeSize;
+    bool empty = false;
+    for(std::size_t i = dimensions; i != 0; --i) {
+        size[i - 1] = tensor.shape[i - 1];
+        stride[i - 1] = tensor.strides ? tensor.strides[i - 1]*std::ptrdiff_t(typeSize) : contiguousStride;
+        contiguousStride *= size[i - 1];
+        if(!size[i - 1])
+            empty = true;
+        else if(stride[i - 1] < 0)
+            min += stride[i - 1]*std::ptrdiff_t(size[i - 1] - 1);
+        else
+            max += stride[i - 1]*std::ptrdiff_t(size[i - 1] - 1);
+    }
+    if(empty) min = max = 0;
+
+    T* const data = reinterpret_cast<T*>(static_cast<char*>(tensor.data) + tensor.byteOffset);
+    const Containers::Pair<py::object(*)(const char*), void(*)(char*, py::handle)> accessors = accessorsForFormat(format);
+    Containers::PyStridedArrayView<dimensions, T> view{
+        Containers::StridedArrayView<dimensions, T>{
+            {data + min, std::size_t(max - min)}, data, size, stride},
+        format,
+        typeSize,
+        accessors.first(),
+        accessors.second()};
+
+    /* Take over the tensor ownership. The capsule is renamed so its
+       destructor doesn't call the deleter anymore, and the tensor is wrapped
+       in a new capsule that's the memory owner. */
+    py::object owner = py::reinterpret_steal<py::object>(PyCapsule_New(managed, nullptr, dlpackOwnerDestructor<Managed>));
+    if(!owner || PyCapsule_SetName(capsule.ptr(), DLPackTraits<Managed>::usedName()) != 0) {
+        /* If the rename failed, the original capsule still owns the tensor,
+           so the new one shouldn't delete it */
+        if(owner) PyCapsule_SetDestructor(owner.ptr(), nullptr);
+        throw py::error_already_set{};
+    }
+    return Containers::pyArrayViewHolder(view, std::move(owner));
+}
+
 template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containers::PyStridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::PyStridedArrayView<dimensions, T>>>& c) {
     /* Implicitly convertible from a buffer */
     py::implicitly_convertible<py::buffer, Containers::PyStridedArrayView<dimensions, T>>();
@@ -659,6 +978,56 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
                 buffer.len ? py::reinterpret_borrow<py::object>(buffer.obj) : py::none{});
         }), "Construct from a buffer")
 
+        /* DLPack */
+        .def_static("from_dlpack", [](py::object other) {
+            /* Ask for a versioned capsule first, which is able to express
+               read-only data, fall back to a legacy one for producers that
+               don't understand max_version yet */
+            py::object capsule;
+            try {
+                capsule = other.attr("__dlpack__")(py::arg("max_version") = py::make_tuple(1, 0));
+            } catch(py::error_already_set& e) {
+                if(!e.matches(PyExc_TypeError))
+                    throw;
+                capsule = other.attr("__dlpack__")();
+            }
+
+            if(PyCapsule_IsValid(capsule.ptr(), DLPackTraits<DLManagedTensorVersioned>::name()))
+                return dlpackImport<DLManagedTensorVersioned, dimensions, T>(capsule);
+            if(PyCapsule_IsValid(capsule.ptr(), DLPackTraits<DLManagedTensor>::name()))
+                return dlpackImport<DLManagedTensor, dimensions, T>(capsule);
+
+            PyErr_SetString(PyExc_BufferError, "expected an unconsumed DLPack capsule");
+            throw py::error_already_set{};
+        }, "Construct from a DLPack-compatible object", py::arg("other"))
+        .def("__dlpack__", [](const Containers::PyStridedArrayView<dimensions, T>& self, py::object stream, py::object maxVersion, py::object dlDevice, py::object copy) {
+            if(!stream.is_none()) {
+                PyErr_SetString(PyExc_BufferError, "only stream=None is supported for CPU data");
+                throw py::error_already_set{};
+            }
+            if(!dlDevice.is_none() && (py::cast<std::int32_t>(dlDevice[py::int_{0}]) != DLDeviceTypeCpu || py::cast<std::int32_t>(dlDevice[py::int_{1}]) != 0)) {
+                PyErr_SetString(PyExc_BufferError, "only export to a CPU device is supported");
+                throw py::error_already_set{};
+            }
+            if(!copy.is_none() && py::cast<bool>(copy)) {
+                PyErr_SetString(PyExc_BufferError, "copying is not supported");
+                throw py::error_already_set{};
+            }
+
+            /* Versioned capsules are only produced if the consumer says it
+               understands them */
+            if(!maxVersion.is_none() && py::cast<std::uint32_t>(maxVersion[py::int_{0}]) >= 1)
+                return dlpackExport<DLManagedTensorVersioned>(self, pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner);
+            return dlpackExport<DLManagedTensor>(self, pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner);
+        }, "Export to DLPack",
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("stream") = py::none{}, py::arg("max_version") = py::none{}, py::arg("dl_device") = py::none{}, py::arg("copy") = py::none{})
+        .def("__dlpack_device__", [](const Containers::PyStridedArrayView<dimensions, T>&) {
+            return py::make_tuple(std::int32_t(DLDeviceTypeCpu), 0);
+        }, "DLPack device")
+
         /* Length, size/stride tuple, dimension count and memory owning object */
         .def("__len__", [](const Containers::PyStridedArrayView<dimensions, T>& self) {
             return Containers::Size<dimensions>(self.size())[0];
@@ -687,6 +1056,36 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
             const Containers::Array<char> out = bytes(Containers::arrayCast<const char>(self));
             return py::bytes(out.data(), out.size());
         }, "Convert to bytes")
+        .def("to_bytes_contiguous", [](const Containers::PyStridedArrayView<dimensions, T>& self) {
+            /* Allocating the bytes object first and copying directly into it
+               to avoid a temporary */
+            const std::size_t size = contiguousSize<dimensions>(self, self.itemsize);
+            py::bytes out = py::reinterpret_steal<py::bytes>(PyBytes_FromStringAndSize(nullptr, size));
+            if(!out)
+                throw py::error_already_set{};
+            copyContiguous<dimensions>(self, self.itemsize, PyBytes_AS_STRING(out.ptr()));
+            return out;
+        }, "Convert to bytes with whole items in a contiguous order")
+        .def("copy_into", [](const Containers::PyStridedArrayView<dimensions, T>& self, const py::buffer& dst) {
+            /* GCC 4.8 otherwise loudly complains about missing initializers */
+            Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+            if(PyObject_GetBuffer(dst.ptr(), &buffer, PyBUF_SIMPLE|PyBUF_WRITABLE) != 0)
+                throw py::error_already_set{};
+
+            Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+            const std::size_t size = contiguousSize<dimensions>(self, self.itemsize);
+            if(std::size_t(buffer.len) < size) {
+                PyErr_Format(PyExc_BufferError, "expected at least %zu bytes but got %zd", size, buffer.len);
+                throw py::error_already_set{};
+            }
+
+            copyContiguous<dimensions>(self, self.itemsize, static_cast<char*>(buffer.buf));
+            return size;
+        }, "Copy whole items into a contiguous buffer", py::arg("dst"))
+        .def("tolist", [](const Containers::PyStridedArrayView<dimensions, T>& self) {
+            return stridedArrayViewToList(Containers::StridedArrayView<dimensions, const char>{self}, itemToPythonForFormat(self.format ? self.format.data() : nullptr, self.itemsize), self.getitem);
+        }, "Convert to a (nested) list")
 
         /* Slicing of the top dimension */
         .def("__getitem__", [](const Containers::PyStridedArrayView<dimensions, T>& self, py::slice slice) {
@@ -0,0 +1,79 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <pybind11/pybind11.h>
+
+#include "../bootstrap.h" /* for module / _module alias */
+
+#include "Corrade/Containers/ArrayPythonBindings.h"
+
+using namespace Corrade;
+namespace py = pybind11;
+
+namespace {
+
+int deletedCount = 0;
+
+Containers::Array<std::uint8_t> unsignedBytes() {
+    return Containers::Array<std::uint8_t>{InPlaceInit, {3, 255, 17, 0}};
+}
+
+Containers::Array<std::int32_t> ints() {
+    return Containers::Array<std::int32_t>{InPlaceInit, {3, -17565, 5}};
+}
+
+Containers::Array<double> doubles() {
+    return Containers::Array<double>{InPlaceInit, {1.5, -2.25}};
+}
+
+Containers::Array<std::int32_t> empty() {
+    return {};
+}
+
+/* Counts deletions to verify the memory is released only once the last view
+   referencing it is gone */
+Containers::Array<float> floatsCustomDeleter() {
+    return Containers::Array<float>{new float[3]{0.5f, 1.25f, -4.0f}, 3, [](float* data, std::size_t) {
+        delete[] data;
+        ++deletedCount;
+    }};
+}
+
+}
+
+/* TODO: remove declaration when https://github.com/pybind/pybind11/pull/1863
+   is released */
+extern "C" PYBIND11_EXPORT PyObject* PyInit_test_array();
+PYBIND11_MODULE(test_array, m) {
+    py::module_::import("corrade.containers");
+
+    m.def("unsigned_bytes", unsignedBytes);
+    m.def("ints", ints);
+    m.def("doubles", doubles);
+    m.def("empty", empty);
+    m.def("floats_custom_deleter", floatsCustomDeleter);
+    m.def("deleted_count", []() { return deletedCount; });
+}
@@ -29,6 +29,7 @@ import sys
 import unittest
 
 from corrade import containers
+import test_array
 import test_stridedarrayview
 import test_optional
 
@@ -521,6 +522,41 @@ class StridedArrayView1D(unittest.TestCase):
         b[-1] = ord('?')
         self.assertEqual(a, b'World is hell?')
 
+    def test_tolist(self):
+        a = containers.StridedArrayView1D(b'hello')
+        self.assertEqual(a.tolist(), [104, 101, 108, 108, 111])
+        self.assertEqual(a[::-2].tolist(), [111, 108, 104])
+        self.assertEqual(containers.StridedArrayView1D().tolist(), [])
+
+        b = containers.StridedArrayView1D(array.array('f', [1.5, -2.25, 3.0]))
+        self.assertEqual(b.tolist(), [1.5, -2.25, 3.0])
+        self.assertIsInstance(b.tolist()[0], float)
+
+        c = containers.StridedArrayView1D(array.array('q', [-1, 1 << 60]))
+        self.assertEqual(c.tolist(), [-1, 1 << 60])
+
+    def test_to_bytes_contiguous(self):
+        a = array.array('H', [0x0102, 0x0304, 0x0506])
+        b = containers.StridedArrayView1D(a)[::2]
+        # Unlike bytes(), this copies whole items
+        self.assertEqual(b.to_bytes_contiguous(), memoryview(a)[::2].tobytes())
+        self.assertEqual(len(b.to_bytes_contiguous()), 4)
+        self.assertEqual(containers.StridedArrayView1D().to_bytes_contiguous(), b'')
+
+    def test_copy_into(self):
+        a = array.array('i', [1, 2, 3, 4])
+        b = containers.StridedArrayView1D(a)[::-1]
+
+        out = bytearray(20)
+        self.assertEqual(b.copy_into(out), 16)
+        self.assertEqual(array.array('i', out[:16]).tolist(), [4, 3, 2, 1])
+        self.assertEqual(out[16:], b'\x00'*4)
+
+        with self.assertRaisesRegex(BufferError, "expected at least 16 bytes but got 15"):
+            b.copy_into(bytearray(15))
+        with self.assertRaisesRegex(BufferError, "not writable"):
+            b.copy_into(b'\x00'*16)
+
 class StridedArrayView2D(unittest.TestCase):
     def test_init(self):
         a = containers.StridedArrayView2D()
@@ -846,6 +882,27 @@ class StridedArrayView2D(unittest.TestCase):
         self.assertEqual(sys.getrefcount(a), a_refcount + 1)
         self.assertEqual(sys.getrefcount(b), b_refcount + 1)
 
+    def test_tolist(self):
+        a = containers.StridedArrayView2D(memoryview(b'01234567'
+                                                     b'456789ab'
+                                                     b'89abcdef').cast('b', shape=[3, 8]))
+        self.assertEqual(a[::2, 1:3].tolist(), [[ord('1'), ord('2')],
+                                                [ord('9'), ord('a')]])
+        self.assertEqual(a.transposed(0, 1)[0].tolist(), [ord('0'), ord('4'), ord('8')])
+
+    def test_to_bytes_contiguous_copy_into(self):
+        a = memoryview(array.array('f', [1.0, 2.0, 3.0,
+                                         4.0, 5.0, 6.0])).cast('B').cast('f', shape=[2, 3])
+        b = containers.StridedArrayView2D(a).transposed(0, 1)
+        self.assertEqual(b.tolist(), [[1.0, 4.0], [2.0, 5.0], [3.0, 6.0]])
+
+        expected = array.array('f', [1.0, 4.0, 2.0, 5.0, 3.0, 6.0]).tobytes()
+        self.assertEqual(b.to_bytes_contiguous(), expected)
+
+        out = bytearray(24)
+        self.assertEqual(b.copy_into(out), 24)
+        self.assertEqual(out, expected)
+
 # Slicing is tested extensively for StridedArrayView2D, this checks just what
 # differs, like constructors and fancy operations
 class StridedArrayView3D(unittest.TestCase):
@@ -1105,6 +1162,16 @@ class StridedArrayViewCustomType(unittest.TestCase):
         with self.assertRaisesRegex(BufferError, "expected a view of format i but got Qf"):
             b.copy_from(memoryview(test_stridedarrayview.MutableContainerlf().view))
 
+    def test_tolist_custom_type(self):
+        # The generic item accessor gets used for types that don't have a fast
+        # path
+        a = test_stridedarrayview.MutableContainerlf()
+        a.view[1][2] = (4666025, -7.5)
+        self.assertEqual(a.view.tolist(), [
+            [(0, 0.0), (0, 0.0), (0, 0.0)],
+            [(0, 0.0), (0, 0.0), (4666025, -7.5)]
+        ])
+
     # mutable_vector3d and mutable_long_float tested in test_containers_numpy
     # as memoryview can't handle their types
 
@@ -1183,6 +1250,109 @@ class StridedArrayViewCustomDynamicType(unittest.TestCase):
         with self.assertRaisesRegex(NotImplementedError, "access to this data format is not implemented, sorry"):
             b[1] = 5
 
+class StridedArrayViewDLPack(unittest.TestCase):
+    def test_device(self):
+        a = containers.StridedArrayView1D(b'hello')
+        self.assertEqual(a.__dlpack_device__(), (1, 0))
+
+    def test_roundtrip(self):
+        a = array.array('f', [2.5, 3.25, -1.75, 53.5])
+        b = containers.MutableStridedArrayView1D(a)[::2]
+        a_refcount = sys.getrefcount(a)
+
+        c = containers.MutableStridedArrayView1D.from_dlpack(b)
+        # The tensor keeps a reference to the original owner
+        self.assertEqual(sys.getrefcount(a), a_refcount + 1)
+        self.assertEqual(c.size, (2, ))
+        self.assertEqual(c.stride, (8, ))
+        self.assertEqual(c.format, 'f')
+        self.assertEqual(c[1], -1.75)
+
+        # It's a view on the same memory
+        c[0] = 7.5
+        self.assertEqual(a[0], 7.5)
+
+        # Deleting the original view doesn't make the memory go away, only
+        # deleting the imported one does
+        del b
+        self.assertEqual(sys.getrefcount(a), a_refcount)
+        del c
+        self.assertEqual(sys.getrefcount(a), a_refcount - 1)
+
+    def test_roundtrip_2d_negative_stride(self):
+        a = array.array('h', [1, 2, 3, 4, 5, 6])
+        b = containers.StridedArrayView1D(a).expanded(0, (2, 3)).flipped(0)
+
+        c = containers.StridedArrayView2D.from_dlpack(b)
+        self.assertEqual(c.size, (2, 3))
+        self.assertEqual(c.stride, (-6, 2))
+        self.assertEqual(c.format, 'h')
+        self.assertEqual(c.tolist(), [[4, 5, 6], [1, 2, 3]])
+
+    def test_roundtrip_legacy_capsule(self):
+        # An object that produces only the unversioned capsule
+        class Legacy:
+            def __init__(self, view):
+                self.view = view
+            def __dlpack__(self):
+                return self.view.__dlpack__()
+
+        a = array.array('i', [15, -7, 23])
+        b = containers.StridedArrayView1D.from_dlpack(Legacy(containers.StridedArrayView1D(a)))
+        self.assertEqual(b.format, 'i')
+        self.assertEqual(b.tolist(), [15, -7, 23])
+
+    def test_multi_component_format(self):
+        a = test_stridedarrayview.MutableContainer3d()
+        self.assertEqual(a.view.format, 'ddd')
+        a.view[1][2] = [4.5, 0.25, -7.5]
+
+        # The component count becomes an extra dimension
+        b = containers.StridedArrayView3D.from_dlpack(a.view)
+        self.assertEqual(b.size, (2, 3, 3))
+        self.assertEqual(b.stride, (72, 24, 8))
+        self.assertEqual(b.format, 'd')
+        self.assertEqual(b[1][2].tolist(), [4.5, 0.25, -7.5])
+
+        with self.assertRaisesRegex(BufferError, "expected 2 dimensions but got 3"):
+            containers.StridedArrayView2D.from_dlpack(a.view)
+
+        # Formats with mixed types can't be represented
+        with self.assertRaisesRegex(BufferError, "format Qf with 16 bytes can't be represented in DLPack"):
+            test_stridedarrayview.MutableContainerlf().view.__dlpack__()
+
+    def test_export_unsupported(self):
+        a = containers.MutableStridedArrayView1D(array.array('L', [1, 2, 3]))
+        # TODO numpy np.int64 results in l even though python's struct
+        #   classifies that as a 4-byte type, so reject it to be safe
+        with self.assertRaisesRegex(BufferError, "format L with 8 bytes can't be represented in DLPack"):
+            a.__dlpack__()
+
+        b = containers.StridedArrayView1D(b'hello')
+        with self.assertRaisesRegex(BufferError, "only stream=None is supported for CPU data"):
+            b.__dlpack__(stream=1)
+        with self.assertRaisesRegex(BufferError, "only export to a CPU device is supported"):
+            b.__dlpack__(dl_device=(2, 0))
+        with self.assertRaisesRegex(BufferError, "copying is not supported"):
+            b.__dlpack__(copy=True)
+
+    def test_import_read_only(self):
+        a = containers.StridedArrayView1D(b'hello')
+        with self.assertRaisesRegex(BufferError, "tensor is read-only"):
+            containers.MutableStridedArrayView1D.from_dlpack(a)
+
+    def test_import_consumed(self):
+        a = containers.StridedArrayView1D(b'hello')
+        capsule = a.__dlpack__()
+
+        class Producer:
+            def __dlpack__(self):
+                return capsule
+
+        containers.StridedArrayView1D.from_dlpack(Producer())
+        with self.assertRaisesRegex(BufferError, "expected an unconsumed DLPack capsule"):
+            containers.StridedArrayView1D.from_dlpack(Producer())
+
 class BitArray(unittest.TestCase):
     def test_init(self):
         a = containers.BitArray()
@@ -2428,3 +2598,69 @@ class Optional(unittest.TestCase):
         self.assertEqual(test_optional.nested_type(True).a, 15)
         self.assertEqual(test_optional.acquire_nested_type(None), -1)
         self.assertEqual(test_optional.acquire_nested_type(test_optional.Foo(25)), 25)
+
+class Array(unittest.TestCase):
+    def test(self):
+        for function, format, itemsize, values in [
+            (test_array.unsigned_bytes, 'B', 1, [3, 255, 17, 0]),
+            (test_array.ints, 'i', 4, [3, -17565, 5]),
+            (test_array.doubles, 'd', 8, [1.5, -2.25])
+        ]:
+            with self.subTest(format=format):
+                a = function()
+                self.assertIsInstance(a, containers.MutableStridedArrayView1D)
+                self.assertEqual(a.format, format)
+                self.assertEqual(a.size, (len(values), ))
+                self.assertEqual(a.stride, (itemsize, ))
+                self.assertEqual(list(a), values)
+
+                # The array is owned by an opaque capsule
+                self.assertEqual(type(a.owner).__name__, 'PyCapsule')
+
+                # Test that memoryview understands the type as well
+                av = memoryview(a)
+                self.assertEqual(av.format, format)
+                self.assertEqual(av.itemsize, itemsize)
+                self.assertFalse(av.readonly)
+                self.assertEqual(av.tolist(), values)
+
+    def test_empty(self):
+        a = test_array.empty()
+        self.assertIsInstance(a, containers.MutableStridedArrayView1D)
+        self.assertEqual(a.format, 'i')
+        self.assertEqual(a.size, (0, ))
+
+    def test_mutable(self):
+        a = test_array.ints()
+        a[1] = 4666
+        self.assertEqual(list(a), [3, 4666, 5])
+
+        # The change is visible through memoryview and the other way around
+        av = memoryview(a)
+        self.assertEqual(av[1], 4666)
+        av[2] = -333
+        self.assertEqual(list(a), [3, 4666, -333])
+
+    def test_owner_lifetime(self):
+        deleted_count = test_array.deleted_count()
+
+        a = test_array.floats_custom_deleter()
+        owner = a.owner
+        owner_refcount = sys.getrefcount(owner)
+
+        b = a[1:]
+        self.assertIs(b.owner, owner)
+        self.assertEqual(sys.getrefcount(owner), owner_refcount + 1)
+
+        # Deleting the returned view doesn't delete the memory if there's
+        # another view on it
+        del a
+        self.assertEqual(sys.getrefcount(owner), owner_refcount)
+        self.assertEqual(test_array.deleted_count(), deleted_count)
+        self.assertEqual(list(b), [1.25, -4.0])
+
+        # It's deleted only once the owner isn't referenced by anything
+        del b
+        self.assertEqual(test_array.deleted_count(), deleted_count)
+        del owner
+        self.assertEqual(test_array.deleted_count(), deleted_count + 1)
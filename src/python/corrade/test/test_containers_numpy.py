@@ -184,3 +184,54 @@ class StridedArrayViewCustomDynamicType(unittest.TestCase):
         b[1, 1, 0] *= -2.0
         self.assertEqual(b[0, 1, 0], 2.0)
         self.assertEqual(b[1, 1, 0], -10.0)
+
+@unittest.skipUnless(hasattr(np, 'from_dlpack'), "numpy doesn't support DLPack")
+class StridedArrayViewDLPack(unittest.TestCase):
+    def test_export(self):
+        a = test_stridedarrayview.MutableContainer3d()
+        a.view[1][2] = [4.5, 0.25, -7.5]
+
+        # The three components become an extra dimension
+        b = np.from_dlpack(a.view)
+        self.assertEqual(b.dtype, 'float64')
+        self.assertEqual(b.shape, (2, 3, 3))
+        self.assertEqual(b.strides, (72, 24, 8))
+        self.assertEqual(tuple(b[1, 2]), (4.5, 0.25, -7.5))
+
+        # It's a view on the same memory
+        b[0, 1, 2] = 15.25
+        self.assertEqual(a.view[0][1][2], 15.25)
+
+    def test_export_flipped(self):
+        a = containers.StridedArrayView1D(np.array([1, 2, 3, 4], np.int16)).flipped(0)
+        b = np.from_dlpack(a)
+        self.assertEqual(b.dtype, 'int16')
+        self.assertEqual(tuple(b), (4, 3, 2, 1))
+
+    def test_import(self):
+        a = np.array([[1.0, 2.0, 3.0], [-4.0, 5.0, 6.0]], np.float32)[:, ::2]
+
+        b = containers.MutableStridedArrayView2D.from_dlpack(a)
+        self.assertEqual(b.size, (2, 2))
+        self.assertEqual(b.stride, (12, 8))
+        self.assertEqual(b.format, 'f')
+        self.assertEqual(b[1, 0], -4.0)
+
+        b[1, 1] *= 2.0
+        self.assertEqual(a[1, 1], 12.0)
+
+    def test_import_read_only(self):
+        # Older numpy versions don't produce versioned capsules and thus can't
+        # express read-only data at all, refusing to export them instead
+        if np.lib.NumpyVersion(np.__version__) < '2.1.0':
+            self.skipTest("numpy can't export read-only data to DLPack")
+
+        a = np.array([1, 2, 3], np.uint32)
+        a.flags.writeable = False
+
+        b = containers.StridedArrayView1D.from_dlpack(a)
+        self.assertEqual(b.format, 'I')
+        self.assertEqual(b.tolist(), [1, 2, 3])
+
+        with self.assertRaisesRegex(BufferError, "tensor is read-only"):
+            containers.MutableStridedArrayView1D.from_dlpack(a)
@@ -37,10 +37,11 @@ from _magnum import *
 # tho, for whatever reason)
 import sys
 sys.modules['magnum.math'] = math
+sys.modules['magnum.animation'] = animation
 
 # In case Magnum is built statically, the whole core project is put into
 # _magnum. Then we need to do the same as above but for all modules.
-for i in ['gl', 'materialtools', 'meshtools', 'platform', 'primitives', 'scenegraph', 'scenetools', 'shaders', 'text', 'trade']:
+for i in ['debugtools', 'gl', 'materialtools', 'meshtools', 'platform', 'primitives', 'scenegraph', 'scenetools', 'shaders', 'text', 'trade']:
     if i in globals(): sys.modules['magnum.' + i] = globals()[i]
 
 # Platform has subpackages
@@ -70,6 +70,8 @@ void mathMatrixFloat(py::module_& root, PyTypeObject* metaclass);
 void mathMatrixDouble(py::module_& root, PyTypeObject* metaclass);
 void mathRange(py::module_& root, py::module_& m);
 
+void animation(py::module_& m);
+void debugtools(py::module_& m);
 void gl(py::module_& m);
 void materialtools(py::module_& m);
 void meshtools(py::module_& m);
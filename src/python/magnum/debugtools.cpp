@@ -0,0 +1,457 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <new>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h> /* for std::vector */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringStl.h> /** @todo drop once we have our string casters */
+#include <Magnum/ImageView.h>
+#include <Magnum/PixelFormat.h>
+#include <Magnum/DebugTools/FrameProfiler.h>
+#include <Magnum/Math/Constants.h>
+#include <Magnum/Math/Functions.h>
+#include <Magnum/Math/Half.h>
+
+#include "Corrade/PythonBindings.h"
+#include "Corrade/Containers/ArrayPythonBindings.h"
+
+#include "corrade/EnumOperators.h"
+#include "magnum/bootstrap.h"
+#include "magnum/acessorsForPixelFormat.h"
+
+namespace magnum { namespace {
+
+/* A custom measurement with Python callbacks. The instance is used as the
+   measurement state pointer, so it's kept alive by the profiler holder below
+   for as long as the profiler references it. */
+struct PyFrameProfilerMeasurement {
+    std::string name;
+    DebugTools::FrameProfiler::Units units;
+    UnsignedInt delay;
+    py::object begin, end, query;
+};
+
+/* Compared to a plain std::unique_ptr keeps the custom measurements alive */
+template<class T> struct PyFrameProfilerHolder: std::unique_ptr<T> {
+    explicit PyFrameProfilerHolder(T* object): std::unique_ptr<T>{object} {}
+
+    Containers::Array<py::object> measurements;
+};
+
+}}
+
+PYBIND11_DECLARE_HOLDER_TYPE(T, magnum::PyFrameProfilerHolder<T>)
+
+namespace magnum { namespace {
+
+void measurementBegin(void* state) {
+    static_cast<PyFrameProfilerMeasurement*>(state)->begin();
+}
+
+UnsignedLong measurementEnd(void* state) {
+    return py::cast<UnsignedLong>(static_cast<PyFrameProfilerMeasurement*>(state)->end());
+}
+
+void measurementBeginDelayed(void* state, UnsignedInt current) {
+    static_cast<PyFrameProfilerMeasurement*>(state)->begin(current);
+}
+
+void measurementEndDelayed(void* state, UnsignedInt current) {
+    static_cast<PyFrameProfilerMeasurement*>(state)->end(current);
+}
+
+UnsignedLong measurementQuery(void* state, UnsignedInt previous, UnsignedInt current) {
+    return py::cast<UnsignedLong>(static_cast<PyFrameProfilerMeasurement*>(state)->query(previous, current));
+}
+
+/* Converts the Python measurement list to the C++ representation and makes
+   the profiler keep a reference to all of them */
+Containers::Array<DebugTools::FrameProfiler::Measurement> frameProfilerMeasurements(PyFrameProfilerHolder<DebugTools::FrameProfiler>& holder, const std::vector<PyFrameProfilerMeasurement*>& measurements) {
+    Containers::Array<DebugTools::FrameProfiler::Measurement> out{NoInit, measurements.size()};
+    Containers::Array<py::object> references{measurements.size()};
+    for(std::size_t i = 0; i != measurements.size(); ++i) {
+        PyFrameProfilerMeasurement& measurement = *measurements[i];
+        if(measurement.delay)
+            new(&out[i]) DebugTools::FrameProfiler::Measurement{measurement.name, measurement.units, measurement.delay, measurementBeginDelayed, measurementEndDelayed, measurementQuery, &measurement};
+        else
+            new(&out[i]) DebugTools::FrameProfiler::Measurement{measurement.name, measurement.units, measurementBegin, measurementEnd, &measurement};
+        /* Returns the already existing Python instance */
+        references[i] = py::cast(measurements[i]);
+    }
+
+    holder.measurements = std::move(references);
+    return out;
+}
+
+void checkMaxFrameCount(const UnsignedInt maxFrameCount) {
+    if(!maxFrameCount) {
+        PyErr_SetString(PyExc_AssertionError, "max frame count can't be zero");
+        throw py::error_already_set{};
+    }
+}
+
+template<class T> void frameProfilerMeasurementAvailable(const T& self, const UnsignedInt id) {
+    if(id >= self.measurementCount()) {
+        PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+        throw py::error_already_set{};
+    }
+    if(!self.isMeasurementAvailable(id)) {
+        PyErr_Format(PyExc_AssertionError, "measurement %u not available yet", id);
+        throw py::error_already_set{};
+    }
+}
+
+/* Calculates a per-pixel delta between two images of the same format and
+   size, the same way as DebugTools::CompareImage does -- raw channel values
+   are compared without any unpacking, a pixel delta is the mean of absolute
+   channel differences, and NaNs or infinities on both sides at the same
+   place are treated as equal. Returns the max and the sum of the deltas. */
+template<class T, std::size_t channels> Containers::Pair<Float, Double> imageDeltaFor(const ImageView2D& actual, const ImageView2D& expected, const Containers::StridedArrayView2D<Float>& out) {
+    const Containers::StridedArrayView2D<const Math::Vector<channels, T>> actualPixels = actual.pixels<Math::Vector<channels, T>>();
+    const Containers::StridedArrayView2D<const Math::Vector<channels, T>> expectedPixels = expected.pixels<Math::Vector<channels, T>>();
+
+    Float max = 0.0f;
+    Double sum = 0.0;
+    for(std::size_t y = 0; y != out.size()[0]; ++y) {
+        for(std::size_t x = 0; x != out.size()[1]; ++x) {
+            const Math::Vector<channels, T>& a = actualPixels[y][x];
+            const Math::Vector<channels, T>& e = expectedPixels[y][x];
+            Float delta = 0.0f;
+            for(std::size_t i = 0; i != channels; ++i) {
+                const Float av = Float(a[i]);
+                const Float ev = Float(e[i]);
+                /* Equal values, including same-signed infinities, or NaN on
+                   both sides */
+                if(av == ev || (av != av && ev != ev)) continue;
+                delta += Math::abs(av - ev);
+            }
+            delta /= channels;
+
+            out[y][x] = delta;
+            /* Propagate NaNs into the max so the comparison fails */
+            if(delta != delta || max != max) max = Constants::nan();
+            else max = Math::max(max, delta);
+            sum += delta;
+        }
+    }
+
+    return {max, sum};
+}
+
+Containers::Pair<Float, Double> imageDelta(const ImageView2D& actual, const ImageView2D& expected, const Containers::StridedArrayView2D<Float>& out) {
+    switch(actual.format()) {
+        #define _c(format, type, channels)                                  \
+            case PixelFormat::format:                                       \
+                return imageDeltaFor<type, channels>(actual, expected, out);
+        /* LCOV_EXCL_START */
+        _c(R8Unorm, UnsignedByte, 1)
+        _c(RG8Unorm, UnsignedByte, 2)
+        _c(RGB8Unorm, UnsignedByte, 3)
+        _c(RGBA8Unorm, UnsignedByte, 4)
+        _c(R8Snorm, Byte, 1)
+        _c(RG8Snorm, Byte, 2)
+        _c(RGB8Snorm, Byte, 3)
+        _c(RGBA8Snorm, Byte, 4)
+        _c(R8Srgb, UnsignedByte, 1)
+        _c(RG8Srgb, UnsignedByte, 2)
+        _c(RGB8Srgb, UnsignedByte, 3)
+        _c(RGBA8Srgb, UnsignedByte, 4)
+        _c(R8UI, UnsignedByte, 1)
+        _c(RG8UI, UnsignedByte, 2)
+        _c(RGB8UI, UnsignedByte, 3)
+        _c(RGBA8UI, UnsignedByte, 4)
+        _c(R8I, Byte, 1)
+        _c(RG8I, Byte, 2)
+        _c(RGB8I, Byte, 3)
+        _c(RGBA8I, Byte, 4)
+        _c(R16Unorm, UnsignedShort, 1)
+        _c(RG16Unorm, UnsignedShort, 2)
+        _c(RGB16Unorm, UnsignedShort, 3)
+        _c(RGBA16Unorm, UnsignedShort, 4)
+        _c(R16Snorm, Short, 1)
+        _c(RG16Snorm, Short, 2)
+        _c(RGB16Snorm, Short, 3)
+        _c(RGBA16Snorm, Short, 4)
+        _c(R16UI, UnsignedShort, 1)
+        _c(RG16UI, UnsignedShort, 2)
+        _c(RGB16UI, UnsignedShort, 3)
+        _c(RGBA16UI, UnsignedShort, 4)
+        _c(R16I, Short, 1)
+        _c(RG16I, Short, 2)
+        _c(RGB16I, Short, 3)
+        _c(RGBA16I, Short, 4)
+        _c(R32UI, UnsignedInt, 1)
+        _c(RG32UI, UnsignedInt, 2)
+        _c(RGB32UI, UnsignedInt, 3)
+        _c(RGBA32UI, UnsignedInt, 4)
+        _c(R32I, Int, 1)
+        _c(RG32I, Int, 2)
+        _c(RGB32I, Int, 3)
+        _c(RGBA32I, Int, 4)
+        _c(R16F, Half, 1)
+        _c(RG16F, Half, 2)
+        _c(RGB16F, Half, 3)
+        _c(RGBA16F, Half, 4)
+        _c(R32F, Float, 1)
+        _c(RG32F, Float, 2)
+        _c(RGB32F, Float, 3)
+        _c(RGBA32F, Float, 4)
+        /* LCOV_EXCL_STOP */
+        #undef _c
+
+        /* Handled by the caller already */
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+#ifdef MAGNUM_TARGET_GL
+template<Double(DebugTools::FrameProfilerGL::*f)() const, DebugTools::FrameProfilerGL::Value value> Double frameProfilerGLMean(const DebugTools::FrameProfilerGL& self) {
+    if(!(self.values() & value)) {
+        PyErr_Format(PyExc_AssertionError, "%S not enabled", py::cast(value).ptr());
+        throw py::error_already_set{};
+    }
+    if(!self.isMeasurementAvailable(value)) {
+        PyErr_Format(PyExc_AssertionError, "%S not available yet", py::cast(value).ptr());
+        throw py::error_already_set{};
+    }
+    return (self.*f)();
+}
+#endif
+
+}
+
+void debugtools(py::module_& m) {
+    m.doc() = "Debug tools";
+
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_BUILD_STATIC)
+    /* These are a part of the same module in the static build, no need to
+       import (also can't import because there it's _magnum.*) */
+    py::module_::import("magnum.gl");
+    #endif
+
+    /*
+        Missing APIs:
+
+        FrameProfiler::printStatistics(), since statistics() returns the
+            same as a string
+        CompareImage and other TestSuite comparators, image_delta() exposes
+            the delta calculation for use in any test framework
+    */
+
+    py::class_<DebugTools::FrameProfiler, PyFrameProfilerHolder<DebugTools::FrameProfiler>> frameProfiler{m, "FrameProfiler", "Frame profiler"};
+
+    py::enum_<DebugTools::FrameProfiler::Units>{frameProfiler, "Units", "Measurement units"}
+        .value("NANOSECONDS", DebugTools::FrameProfiler::Units::Nanoseconds)
+        .value("BYTES", DebugTools::FrameProfiler::Units::Bytes)
+        .value("COUNT", DebugTools::FrameProfiler::Units::Count)
+        .value("RATIO_THOUSANDTHS", DebugTools::FrameProfiler::Units::RatioThousandths)
+        .value("PERCENTAGE_THOUSANDTHS", DebugTools::FrameProfiler::Units::PercentageThousandths);
+
+    py::class_<PyFrameProfilerMeasurement>{frameProfiler, "Measurement", "Measurement"}
+        .def(py::init([](const std::string& name, DebugTools::FrameProfiler::Units units, py::function begin, py::function end) {
+            return PyFrameProfilerMeasurement{name, units, 0, std::move(begin), std::move(end), py::none{}};
+        }), "Construct an immediate measurement", py::arg("name"), py::arg("units"), py::arg("begin"), py::arg("end"))
+        .def(py::init([](const std::string& name, DebugTools::FrameProfiler::Units units, UnsignedInt delay, py::function begin, py::function end, py::function query) {
+            if(!delay) {
+                PyErr_SetString(PyExc_AssertionError, "delay can't be zero");
+                throw py::error_already_set{};
+            }
+            return PyFrameProfilerMeasurement{name, units, delay, std::move(begin), std::move(end), std::move(query)};
+        }), "Construct a delayed measurement", py::arg("name"), py::arg("units"), py::arg("delay"), py::arg("begin"), py::arg("end"), py::arg("query"))
+        .def_property_readonly("name", [](const PyFrameProfilerMeasurement& self) {
+            return self.name;
+        }, "Measurement name")
+        .def_property_readonly("units", [](const PyFrameProfilerMeasurement& self) {
+            return self.units;
+        }, "Measurement units")
+        .def_property_readonly("delay", [](const PyFrameProfilerMeasurement& self) {
+            return self.delay;
+        }, "Measurement delay");
+
+    frameProfiler
+        .def(py::init(), "Default constructor")
+        .def(py::init([](const std::vector<PyFrameProfilerMeasurement*>& measurements, UnsignedInt maxFrameCount) {
+            checkMaxFrameCount(maxFrameCount);
+            PyFrameProfilerHolder<DebugTools::FrameProfiler> holder{new DebugTools::FrameProfiler};
+            holder->setup(frameProfilerMeasurements(holder, measurements), maxFrameCount);
+            return holder;
+        }), "Constructor", py::arg("measurements"), py::arg("max_frame_count"))
+        .def("setup", [](DebugTools::FrameProfiler& self, const std::vector<PyFrameProfilerMeasurement*>& measurements, UnsignedInt maxFrameCount) {
+            checkMaxFrameCount(maxFrameCount);
+            self.setup(frameProfilerMeasurements(pyObjectHolderFor<PyFrameProfilerHolder>(self), measurements), maxFrameCount);
+        }, "Setup measurements", py::arg("measurements"), py::arg("max_frame_count"))
+        .def_property_readonly("is_enabled", &DebugTools::FrameProfiler::isEnabled, "Whether profiling is enabled")
+        .def("enable", &DebugTools::FrameProfiler::enable, "Enable the profiler")
+        .def("disable", &DebugTools::FrameProfiler::disable, "Disable the profiler")
+        .def("begin_frame", &DebugTools::FrameProfiler::beginFrame, "Begin a frame")
+        .def("end_frame", &DebugTools::FrameProfiler::endFrame, "End a frame")
+        .def_property_readonly("max_frame_count", &DebugTools::FrameProfiler::maxFrameCount, "Max count of generated frames")
+        .def_property_readonly("measured_frame_count", &DebugTools::FrameProfiler::measuredFrameCount, "Count of measured frames")
+        .def_property_readonly("measurement_count", &DebugTools::FrameProfiler::measurementCount, "Measurement count")
+        .def("measurement_name", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            if(id < self.measurementCount())
+                return std::string{self.measurementName(id)};
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+            throw py::error_already_set{};
+        }, "Measurement name", py::arg("id"))
+        .def("measurement_units", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            if(id < self.measurementCount())
+                return self.measurementUnits(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+            throw py::error_already_set{};
+        }, "Measurement units", py::arg("id"))
+        .def("measurement_delay", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            if(id < self.measurementCount())
+                return self.measurementDelay(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+            throw py::error_already_set{};
+        }, "Measurement delay", py::arg("id"))
+        .def("is_measurement_available", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            if(id < self.measurementCount())
+                return self.isMeasurementAvailable(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+            throw py::error_already_set{};
+        }, "Whether given measurement is available", py::arg("id"))
+        .def("measurement_mean", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            frameProfilerMeasurementAvailable(self, id);
+            return self.measurementMean(id);
+        }, "Measurement mean", py::arg("id"))
+        .def("measurement_data", [](const DebugTools::FrameProfiler& self, UnsignedInt id) {
+            frameProfilerMeasurementAvailable(self, id);
+            /* Once a measurement is available, the whole window of
+               max_frame_count frames is filled, oldest first */
+            Containers::Array<Double> out{NoInit, self.maxFrameCount()};
+            for(UnsignedInt i = 0; i != out.size(); ++i)
+                out[i] = self.measurementData(id, i);
+            return out;
+        }, "Measurement data for all frames in the window", py::arg("id"))
+        .def("statistics", [](const DebugTools::FrameProfiler& self) {
+            return std::string{self.statistics()};
+        }, "Overview of all measurements");
+
+    #ifdef MAGNUM_TARGET_GL
+    py::class_<DebugTools::FrameProfilerGL, DebugTools::FrameProfiler, PyFrameProfilerHolder<DebugTools::FrameProfilerGL>> frameProfilerGL{m, "FrameProfilerGL", "OpenGL frame profiler"};
+
+    py::enum_<DebugTools::FrameProfilerGL::Value> value{frameProfilerGL, "Values", "Measured value"};
+    value
+        .value("FRAME_TIME", DebugTools::FrameProfilerGL::Value::FrameTime)
+        .value("CPU_DURATION", DebugTools::FrameProfilerGL::Value::CpuDuration)
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        .value("GPU_DURATION", DebugTools::FrameProfilerGL::Value::GpuDuration)
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .value("VERTEX_FETCH_RATIO", DebugTools::FrameProfilerGL::Value::VertexFetchRatio)
+        .value("PRIMITIVE_CLIP_RATIO", DebugTools::FrameProfilerGL::Value::PrimitiveClipRatio)
+        #endif
+        .value("NONE", DebugTools::FrameProfilerGL::Value{});
+    corrade::enumOperators(value);
+
+    frameProfilerGL
+        .def(py::init(), "Default constructor")
+        .def(py::init([](DebugTools::FrameProfilerGL::Value values, UnsignedInt maxFrameCount) {
+            checkMaxFrameCount(maxFrameCount);
+            return PyFrameProfilerHolder<DebugTools::FrameProfilerGL>{new DebugTools::FrameProfilerGL{values, maxFrameCount}};
+        }), "Constructor", py::arg("values"), py::arg("max_frame_count"))
+        .def("setup", [](DebugTools::FrameProfilerGL& self, DebugTools::FrameProfilerGL::Value values, UnsignedInt maxFrameCount) {
+            checkMaxFrameCount(maxFrameCount);
+            self.setup(values, maxFrameCount);
+        }, "Setup measured values", py::arg("values"), py::arg("max_frame_count"))
+        .def_property_readonly("values", [](const DebugTools::FrameProfilerGL& self) {
+            return DebugTools::FrameProfilerGL::Value(Containers::enumCastUnderlyingType(self.values()));
+        }, "Measured values")
+        .def("is_measurement_available", [](const DebugTools::FrameProfilerGL& self, DebugTools::FrameProfilerGL::Value value) {
+            if(!(self.values() & value)) {
+                PyErr_Format(PyExc_AssertionError, "%S not enabled", py::cast(value).ptr());
+                throw py::error_already_set{};
+            }
+            return self.isMeasurementAvailable(value);
+        }, "Whether given measurement is available", py::arg("value"))
+        /* The id overload has to be re-added as the above hides it */
+        .def("is_measurement_available", [](const DebugTools::FrameProfilerGL& self, UnsignedInt id) {
+            if(id < self.measurementCount())
+                return self.isMeasurementAvailable(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u measurements", id, self.measurementCount());
+            throw py::error_already_set{};
+        }, "Whether given measurement is available", py::arg("id"))
+        .def_property_readonly("frame_time_mean", frameProfilerGLMean<&DebugTools::FrameProfilerGL::frameTimeMean, DebugTools::FrameProfilerGL::Value::FrameTime>, "Frame time mean in nanoseconds")
+        .def_property_readonly("cpu_duration_mean", frameProfilerGLMean<&DebugTools::FrameProfilerGL::cpuDurationMean, DebugTools::FrameProfilerGL::Value::CpuDuration>, "CPU duration mean in nanoseconds")
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        .def_property_readonly("gpu_duration_mean", frameProfilerGLMean<&DebugTools::FrameProfilerGL::gpuDurationMean, DebugTools::FrameProfilerGL::Value::GpuDuration>, "GPU duration mean in nanoseconds")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .def_property_readonly("vertex_fetch_ratio_mean", frameProfilerGLMean<&DebugTools::FrameProfilerGL::vertexFetchRatioMean, DebugTools::FrameProfilerGL::Value::VertexFetchRatio>, "Vertex fetch ratio mean in thousandths")
+        .def_property_readonly("primitive_clip_ratio_mean", frameProfilerGLMean<&DebugTools::FrameProfilerGL::primitiveClipRatioMean, DebugTools::FrameProfilerGL::Value::PrimitiveClipRatio>, "Primitive clip ratio mean in thousandths")
+        #endif
+        ;
+    #endif
+
+    m
+        .def("image_delta", [](const ImageView2D& actual, const ImageView2D& expected) {
+            if(actual.format() != expected.format()) {
+                PyErr_Format(PyExc_AssertionError, "expected %S but got %S", py::cast(expected.format()).ptr(), py::cast(actual.format()).ptr());
+                throw py::error_already_set{};
+            }
+            if(actual.size() != expected.size()) {
+                PyErr_Format(PyExc_AssertionError, "expected size %S but got %S", py::cast(expected.size()).ptr(), py::cast(actual.size()).ptr());
+                throw py::error_already_set{};
+            }
+            /* Supporting the same set of formats as Image.pixels */
+            if(!accessorsForPixelFormat(actual.format()).first()) {
+                PyErr_SetString(PyExc_NotImplementedError, "delta calculation for this pixel format is not implemented yet, sorry");
+                throw py::error_already_set{};
+            }
+
+            const std::size_t size = std::size_t(actual.size().product());
+            Containers::Array<Float> out{NoInit, size};
+            const Containers::StridedArrayView2D<Float> outView{out, {std::size_t(actual.size().y()), std::size_t(actual.size().x())}};
+            Containers::Pair<Float, Double> maxSum;
+            {
+                /* The images are referenced directly, with no copies */
+                py::gil_scoped_release release;
+                maxSum = imageDelta(actual, expected, outView);
+            }
+            return py::make_tuple(pyCastButNotShitty(Containers::pyArrayViewHolder(Containers::PyStridedArrayView<2, char>{outView}, Containers::pyArrayOwner(std::move(out)))), maxSum.first(), size ? Float(maxSum.second()/size) : 0.0f);
+        }, "Calculate a per-pixel delta between two images", py::arg("actual"), py::arg("expected"));
+}
+
+}
+
+#ifndef MAGNUM_BUILD_STATIC
+/* TODO: remove declaration when https://github.com/pybind/pybind11/pull/1863
+   is released */
+extern "C" PYBIND11_EXPORT PyObject* PyInit_debugtools();
+PYBIND11_MODULE(debugtools, m) {
+    magnum::debugtools(m);
+}
+#endif
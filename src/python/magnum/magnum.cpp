@@ -781,6 +781,9 @@ PYBIND11_MODULE(_magnum, m) {
     /* These need stuff from math, so need to be called after */
     magnum::magnum(m);
 
+    py::module_ animation = m.def_submodule("animation");
+    magnum::animation(animation);
+
     /* In case Magnum is a bunch of static libraries, put everything into a
        single shared lib to make it easier to install (which is the point of
        static builds) and avoid issues with multiply-defined global symbols.
@@ -837,6 +840,12 @@ PYBIND11_MODULE(_magnum, m) {
     magnum::shaders(shaders);
     #endif
 
+    #ifdef Magnum_DebugTools_FOUND
+    /* Depends on gl */
+    py::module_ debugtools = m.def_submodule("debugtools");
+    magnum::debugtools(debugtools);
+    #endif
+
     /* Keep the doc in sync with platform/__init__.py */
     py::module_ platform = m.def_submodule("platform");
     platform.doc() = "Platform-specific application and context creation";
@@ -0,0 +1,161 @@
+#ifndef magnum_math_batch_h
+#define magnum_math_batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <pybind11/pybind11.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Magnum/Math/Vector4.h>
+
+#include "Corrade/Containers/ArrayPythonBindings.h"
+#include "Magnum/StridedArrayViewPythonBindings.h"
+
+#include "magnum/bootstrap.h"
+
+namespace magnum {
+
+/* Batched variants of math operations accept either a 1D view with each item
+   being a whole vector such as 3f, or a 2D view with vector components in
+   the second dimension, such as a Nx3 numpy array. Both get turned into a
+   typed 1D view of vectors, keeping the constness of the input. */
+
+template<class T, class U> using BatchType = typename std::conditional<std::is_const<U>::value, const T, T>::type;
+
+template<class T, class U> bool isBatchVectorView(const Containers::PyStridedArrayView<1, U>& view) {
+    return view.itemsize == sizeof(T) && Containers::StringView{view.format} == Containers::StringView{Containers::Implementation::pythonFormatString<T>()};
+}
+
+template<class T, class U> bool isBatchVectorView(const Containers::PyStridedArrayView<2, U>& view) {
+    return view.size()[1] == T::Size && view.itemsize == sizeof(typename T::Type) && Containers::StringView{view.format} == Containers::StringView{Containers::Implementation::pythonFormatString<typename T::Type>()};
+}
+
+template<class T, class U> Containers::StridedArrayView1D<BatchType<T, U>> batchVectorView(const Containers::PyStridedArrayView<1, U>& view, const char* const name) {
+    if(!isBatchVectorView<T>(view)) {
+        PyErr_Format(PyExc_AssertionError, "expected %s to have %s items, got %s", name, Containers::Implementation::pythonFormatString<T>(), view.format ? view.format.data() : "B");
+        throw py::error_already_set{};
+    }
+
+    return Containers::arrayCast<BatchType<T, U>>(view);
+}
+
+template<class T, class U> Containers::StridedArrayView1D<BatchType<T, U>> batchVectorView(const Containers::PyStridedArrayView<2, U>& view, const char* const name) {
+    if(!isBatchVectorView<T>(view)) {
+        PyErr_Format(PyExc_AssertionError, "expected %s to have %zu %s items in the second dimension, got %zu %s", name, std::size_t(T::Size), Containers::Implementation::pythonFormatString<typename T::Type>(), view.size()[1], view.format ? view.format.data() : "B");
+        throw py::error_already_set{};
+    }
+    if(std::size_t(view.stride()[1]) != view.itemsize) {
+        PyErr_Format(PyExc_AssertionError, "second dimension of %s is not contiguous", name);
+        throw py::error_already_set{};
+    }
+
+    return Containers::arrayCast<1, BatchType<T, U>>(Containers::arrayCast<BatchType<typename T::Type, U>>(view));
+}
+
+/* Moves an array of vectors into a Python object owning its memory and
+   returns a Nx2, Nx3 or Nx4 view on its components */
+template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<2, char>> batchVectorArray(Containers::Array<T>&& vectors) {
+    const Containers::StridedArrayView2D<typename T::Type> components = Containers::arrayCast<2, typename T::Type>(Containers::stridedArrayView(vectors));
+    return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<2, char>{components}, Containers::pyArrayOwner(std::move(vectors)));
+}
+
+template<class T, class V, V(T::*function)(const V&) const> void transformBatch(const T& transformation, const Containers::StridedArrayView1D<const V>& src, const Containers::StridedArrayView1D<V>& dst) {
+    /* The views are kept alive by the caller, so nothing Python-related
+       happens in the loop */
+    py::gil_scoped_release release;
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = (transformation.*function)(src[i]);
+}
+
+template<class T, class V, V(T::*function)(const V&) const, unsigned dimensions> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<2, char>> transformBatchCopy(const T& self, const Containers::PyStridedArrayView<dimensions, const char>& src) {
+    const Containers::StridedArrayView1D<const V> srcVectors = batchVectorView<V>(src, "src");
+    Containers::Array<V> out{NoInit, srcVectors.size()};
+    transformBatch<T, V, function>(self, srcVectors, out);
+    return batchVectorArray(std::move(out));
+}
+
+template<class T, class V, V(T::*function)(const V&) const, unsigned srcDimensions, unsigned dstDimensions> void transformBatchInto(const T& self, const Containers::PyStridedArrayView<srcDimensions, const char>& src, const Containers::PyStridedArrayView<dstDimensions, char>& dst) {
+    const Containers::StridedArrayView1D<const V> srcVectors = batchVectorView<V>(src, "src");
+    const Containers::StridedArrayView1D<V> dstVectors = batchVectorView<V>(dst, "dst");
+    if(srcVectors.size() != dstVectors.size()) {
+        PyErr_Format(PyExc_AssertionError, "expected dst to have %zu items, got %zu", srcVectors.size(), dstVectors.size());
+        throw py::error_already_set{};
+    }
+
+    transformBatch<T, V, function>(self, srcVectors, dstVectors);
+}
+
+/* Without dst the result is put into a newly allocated Nx2 / Nx3 view,
+   otherwise it's written into dst, which is allowed to be the same as src */
+template<class T, class V, V(T::*function)(const V&) const, class ...Args> void transformBatchFunctions(py::class_<T, Args...>& c, const char* const name, const char* const docstring) {
+    c
+        .def(name, transformBatchCopy<T, V, function, 1>, docstring, py::arg("src"))
+        .def(name, transformBatchCopy<T, V, function, 2>, docstring, py::arg("src"))
+        .def(name, transformBatchInto<T, V, function, 1, 1>, docstring, py::arg("src"), py::arg("dst"))
+        .def(name, transformBatchInto<T, V, function, 1, 2>, docstring, py::arg("src"), py::arg("dst"))
+        .def(name, transformBatchInto<T, V, function, 2, 1>, docstring, py::arg("src"), py::arg("dst"))
+        .def(name, transformBatchInto<T, V, function, 2, 2>, docstring, py::arg("src"), py::arg("dst"));
+}
+
+template<class T, unsigned aDimensions, unsigned bDimensions> Containers::Array<typename T::Type> dotBatchFor(const Containers::PyStridedArrayView<aDimensions, const char>& a, const Containers::PyStridedArrayView<bDimensions, const char>& b) {
+    const Containers::StridedArrayView1D<const T> aVectors = batchVectorView<T>(a, "a");
+    const Containers::StridedArrayView1D<const T> bVectors = batchVectorView<T>(b, "b");
+    if(aVectors.size() != bVectors.size()) {
+        PyErr_Format(PyExc_AssertionError, "expected b to have %zu items, got %zu", aVectors.size(), bVectors.size());
+        throw py::error_already_set{};
+    }
+
+    Containers::Array<typename T::Type> out{NoInit, aVectors.size()};
+    {
+        py::gil_scoped_release release;
+        for(std::size_t i = 0; i != aVectors.size(); ++i)
+            out[i] = Math::dot(aVectors[i], bVectors[i]);
+    }
+    return out;
+}
+
+/* The vector type is picked based on the first argument, the second is then
+   expected to match */
+template<unsigned aDimensions, unsigned bDimensions> py::object dotBatch(const Containers::PyStridedArrayView<aDimensions, const char>& a, const Containers::PyStridedArrayView<bDimensions, const char>& b) {
+    if(isBatchVectorView<Vector2>(a))
+        return py::cast(dotBatchFor<Vector2>(a, b));
+    if(isBatchVectorView<Vector3>(a))
+        return py::cast(dotBatchFor<Vector3>(a, b));
+    if(isBatchVectorView<Vector4>(a))
+        return py::cast(dotBatchFor<Vector4>(a, b));
+    if(isBatchVectorView<Vector2d>(a))
+        return py::cast(dotBatchFor<Vector2d>(a, b));
+    if(isBatchVectorView<Vector3d>(a))
+        return py::cast(dotBatchFor<Vector3d>(a, b));
+    if(isBatchVectorView<Vector4d>(a))
+        return py::cast(dotBatchFor<Vector4d>(a, b));
+
+    PyErr_Format(PyExc_AssertionError, "expected a to be a view of two-, three- or four-component float or double vectors, got %s", a.format ? a.format.data() : "B");
+    throw py::error_already_set{};
+}
+
+}
+
+#endif
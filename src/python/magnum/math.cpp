@@ -37,6 +37,7 @@
 
 #include "magnum/bootstrap.h"
 #include "magnum/math.h"
+#include "magnum/math.batch.h"
 
 namespace magnum {
 
@@ -491,6 +492,9 @@ template<class T> void quaternion(py::module_& m, py::class_<T>& c) {
         .def_property_readonly("wxyz", &T::wxyz, "Quaternion components in a WXYZ order")
 
         .def("__repr__", repr<T>, "Object representation");
+
+    /* Batched rotation of whole buffers */
+    transformBatchFunctions<T, Math::Vector3<typename T::Type>, &T::transformVector>(c, "transform_vectors", "Rotate a batch of vectors with a quaternion");
 }
 
 /* Behaves exactly like Py_Type_Type.tp_getattro but redirects access to the
@@ -679,6 +683,16 @@ void math(py::module_& root, py::module_& m) {
 
     /* Range */
     magnum::mathRange(root, m);
+
+    /* Batched dot product. Registered only after all vector and quaternion
+       overloads so these get picked for single vectors first -- as they
+       implement the buffer protocol, they'd be convertible to a view as
+       well. */
+    m
+        .def("dot", dotBatch<1, 1>, "Dot product of two batches of vectors", py::arg("a"), py::arg("b"))
+        .def("dot", dotBatch<1, 2>, "Dot product of two batches of vectors", py::arg("a"), py::arg("b"))
+        .def("dot", dotBatch<2, 1>, "Dot product of two batches of vectors", py::arg("a"), py::arg("b"))
+        .def("dot", dotBatch<2, 2>, "Dot product of two batches of vectors", py::arg("a"), py::arg("b"));
 }
 
 }
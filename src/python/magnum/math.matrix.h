@@ -35,6 +35,7 @@
 #include "corrade/PyBuffer.h"
 
 #include "magnum/math.h"
+#include "magnum/math.batch.h"
 
 namespace magnum {
 
@@ -789,6 +790,10 @@ Overloaded function.
         [](Math::Matrix3<T>& self, const Math::Vector2<T>& value) { self.translation() = value; },
         "2D translation part of the matrix");
 
+    /* Batched transformations of whole buffers */
+    transformBatchFunctions<Math::Matrix3<T>, Math::Vector2<T>, &Math::Matrix3<T>::transformVector>(matrix3, "transform_vectors", "Transform a batch of 2D vectors with the matrix");
+    transformBatchFunctions<Math::Matrix3<T>, Math::Vector2<T>, &Math::Matrix3<T>::transformPoint>(matrix3, "transform_points", "Transform a batch of 2D points with the matrix");
+
     /* 4x4 transformation matrix. Buffer constructors need to be *before* tuple
        constructors so numpy buffer protocol gets extracted correctly. */
     py::implicitly_convertible<Math::Matrix4x4<T>, Math::Matrix4<T>>();
@@ -1048,6 +1053,10 @@ Overloaded function.
         static_cast<Math::Vector3<T>(Math::Matrix4<T>::*)() const>(&Math::Matrix4<T>::translation),
         [](Math::Matrix4<T>& self, const Math::Vector3<T>& value) { self.translation() = value; },
         "3D translation part of the matrix");
+
+    /* Batched transformations of whole buffers */
+    transformBatchFunctions<Math::Matrix4<T>, Math::Vector3<T>, &Math::Matrix4<T>::transformVector>(matrix4, "transform_vectors", "Transform a batch of 3D vectors with the matrix");
+    transformBatchFunctions<Math::Matrix4<T>, Math::Vector3<T>, &Math::Matrix4<T>::transformPoint>(matrix4, "transform_points", "Transform a batch of 3D points with the matrix");
 }
 
 }
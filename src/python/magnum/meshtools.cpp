@@ -24,12 +24,23 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <cstring>
+#include <thread>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h> /* for std::vector */
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Magnum/GL/Mesh.h>
+#include <Magnum/Math/Functions.h>
+#include <Magnum/Math/Range.h>
+#include <Magnum/Math/Vector4.h>
+#include <Magnum/MeshTools/BoundingVolume.h>
 #include <Magnum/MeshTools/Compile.h>
 #include <Magnum/MeshTools/CompressIndices.h>
 #include <Magnum/MeshTools/Copy.h>
@@ -37,12 +48,15 @@
 #include <Magnum/MeshTools/Duplicate.h>
 #include <Magnum/MeshTools/Filter.h>
 #include <Magnum/MeshTools/GenerateIndices.h>
+#include <Magnum/MeshTools/GenerateNormals.h>
 #include <Magnum/MeshTools/Interleave.h>
 #include <Magnum/MeshTools/RemoveDuplicates.h>
+#include <Magnum/MeshTools/Tipsify.h>
 #include <Magnum/MeshTools/Transform.h>
 #include <Magnum/Trade/MeshData.h>
 
 #include "Corrade/PythonBindings.h"
+#include "Corrade/Containers/ArrayPythonBindings.h"
 #include "Magnum/Trade/PythonBindings.h"
 
 #include "corrade/EnumOperators.h"
@@ -50,6 +64,291 @@
 
 namespace magnum {
 
+namespace {
+
+/* Calls given operation with indices in range [0, count), distributing them
+   across worker threads. Has to be called with the GIL released, thus the
+   operation isn't allowed to touch any Python objects. */
+template<class F> void parallelFor(const std::size_t count, UnsignedInt threadCount, const F& operation) {
+    if(!threadCount)
+        threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = Math::min(threadCount, UnsignedInt(count));
+
+    /* Each worker picks the next unprocessed item, which balances the load
+       even if the items vary wildly in size */
+    std::atomic<std::size_t> next{0};
+    const auto work = [&]() {
+        for(;;) {
+            const std::size_t i = next++;
+            if(i >= count) break;
+            operation(i);
+        }
+    };
+
+    /* The calling thread is one of the workers as well */
+    Containers::Array<std::thread> threads{threadCount ? threadCount - 1 : 0};
+    for(std::thread& thread: threads)
+        thread = std::thread{work};
+    work();
+    for(std::thread& thread: threads)
+        thread.join();
+}
+
+/* Runs given operation on all meshes, distributing them across worker
+   threads, and returns the results in the same order. All Python-side checks
+   have to be done before, as the operation is executed with the GIL released
+   and thus isn't allowed to touch any Python objects. The meshes are kept
+   alive by the list passed from Python for the whole duration of the call. */
+template<class F> py::list batch(const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, const UnsignedInt threadCount, const F& operation) {
+    Containers::Array<Containers::Optional<Trade::MeshData>> results{meshes.size()};
+    {
+        py::gil_scoped_release release;
+        parallelFor(meshes.size(), threadCount, [&](const std::size_t i) {
+            results[i].emplace(operation(meshes[i].get()));
+        });
+    }
+
+    py::list out{meshes.size()};
+    for(std::size_t i = 0; i != results.size(); ++i)
+        out[i] = py::cast(std::move(*results[i]));
+    return out;
+}
+
+void checkIndexInRange(const UnsignedInt index, const UnsignedInt vertexCount) {
+    if(index >= vertexCount) {
+        PyErr_Format(PyExc_AssertionError, "index %u out of range for %u vertices", index, vertexCount);
+        throw py::error_already_set{};
+    }
+}
+
+/* Average number of post-transform vertex cache misses per triangle, with the
+   cache modelled as a FIFO. A vertex is in the cache if it was inserted less
+   than cacheSize misses ago. */
+Float averageCacheMissRatio(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    if(indices.isEmpty()) return 0.0f;
+
+    Containers::Array<std::size_t> insertedAt{ValueInit, vertexCount};
+    std::size_t misses = 0;
+    for(const UnsignedInt index: indices) {
+        checkIndexInRange(index, vertexCount);
+        if(insertedAt[index] && misses - insertedAt[index] < cacheSize)
+            continue;
+        insertedAt[index] = ++misses;
+    }
+
+    return Float(misses)/(indices.size()/3);
+}
+
+template<class T> void remapIndices(const Containers::StridedArrayView1D<T>& indices, const Containers::ArrayView<const UnsignedInt> remap) {
+    for(T& index: indices) index = remap[index];
+}
+
+/* Reorders vertices in the order they're first referenced by the index
+   buffer, unreferenced vertices are put at the end. Operates on an owned
+   copy, preserving the original attribute layout. */
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh) {
+    const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+
+    /* Mapping from old vertex IDs to new and from new to old */
+    Containers::Array<UnsignedInt> remap{DirectInit, mesh.vertexCount(), ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> order{NoInit, mesh.vertexCount()};
+    UnsignedInt count = 0;
+    for(const UnsignedInt index: indices) {
+        checkIndexInRange(index, mesh.vertexCount());
+        if(remap[index] != ~UnsignedInt{}) continue;
+        remap[index] = count;
+        order[count++] = index;
+    }
+    for(UnsignedInt i = 0; i != mesh.vertexCount(); ++i) {
+        if(remap[i] != ~UnsignedInt{}) continue;
+        remap[i] = count;
+        order[count++] = i;
+    }
+
+    Trade::MeshData out = MeshTools::copy(mesh);
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const Containers::StridedArrayView2D<const char> src = mesh.attribute(i);
+        const Containers::StridedArrayView2D<char> dst = out.mutableAttribute(i);
+        for(UnsignedInt j = 0; j != mesh.vertexCount(); ++j)
+            std::memcpy(dst[j].data(), src[order[j]].data(), src.size()[1]);
+    }
+
+    switch(out.indexType()) {
+        case MeshIndexType::UnsignedByte:
+            remapIndices(out.mutableIndices<UnsignedByte>(), remap);
+            break;
+        case MeshIndexType::UnsignedShort:
+            remapIndices(out.mutableIndices<UnsignedShort>(), remap);
+            break;
+        case MeshIndexType::UnsignedInt:
+            remapIndices(out.mutableIndices<UnsignedInt>(), remap);
+            break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    return out;
+}
+
+/* Common checks for the normal and tangent generation APIs */
+void checkTriangles3D(const Trade::MeshData& mesh) {
+    if(mesh.primitive() != MeshPrimitive::Triangles) {
+        PyErr_Format(PyExc_AssertionError, "expected %S but got %S", py::cast(MeshPrimitive::Triangles).ptr(), py::cast(mesh.primitive()).ptr());
+        throw py::error_already_set{};
+    }
+    if(mesh.isIndexed() && mesh.indexCount() % 3) {
+        PyErr_Format(PyExc_AssertionError, "expected index count to be divisible by 3, got %u", mesh.indexCount());
+        throw py::error_already_set{};
+    }
+    if(!mesh.isIndexed() && mesh.vertexCount() % 3) {
+        PyErr_Format(PyExc_AssertionError, "expected vertex count to be divisible by 3, got %u", mesh.vertexCount());
+        throw py::error_already_set{};
+    }
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    if(!positionAttributeId) {
+        PyErr_SetString(PyExc_KeyError, "the mesh has no positions");
+        throw py::error_already_set{};
+    }
+    if(vertexFormatComponentCount(mesh.attributeFormat(*positionAttributeId)) != 3) {
+        PyErr_Format(PyExc_AssertionError, "expected 3D positions but got %S", py::cast(mesh.attributeFormat(*positionAttributeId)).ptr());
+        throw py::error_already_set{};
+    }
+    /** @todo check that the indices/vertices aren't impl-specific once it's
+        possible to test */
+}
+
+/* Per-vertex tangents with handedness in the fourth component, calculated by
+   accumulating per-triangle tangents and bitangents derived from texture
+   coordinate gradients, and then orthogonalizing them against the normal */
+Containers::Array<Vector4> generateTangents(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<const Vector3> normals, const Containers::ArrayView<const Vector2> textureCoordinates) {
+    Containers::Array<Vector3> tangents{ValueInit, positions.size()};
+    Containers::Array<Vector3> bitangents{ValueInit, positions.size()};
+    for(std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const UnsignedInt a = indices[i + 0];
+        const UnsignedInt b = indices[i + 1];
+        const UnsignedInt c = indices[i + 2];
+        const Vector3 e1 = positions[b] - positions[a];
+        const Vector3 e2 = positions[c] - positions[a];
+        const Vector2 uv1 = textureCoordinates[b] - textureCoordinates[a];
+        const Vector2 uv2 = textureCoordinates[c] - textureCoordinates[a];
+        const Float determinant = uv1.x()*uv2.y() - uv2.x()*uv1.y();
+        /* Degenerate texture mapping, the triangle doesn't contribute */
+        if(Math::abs(determinant) < Math::TypeTraits<Float>::epsilon())
+            continue;
+
+        const Vector3 tangent = (e1*uv2.y() - e2*uv1.y())/determinant;
+        const Vector3 bitangent = (e2*uv1.x() - e1*uv2.x())/determinant;
+        for(const UnsignedInt index: {a, b, c}) {
+            tangents[index] += tangent;
+            bitangents[index] += bitangent;
+        }
+    }
+
+    Containers::Array<Vector4> out{NoInit, positions.size()};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector3 normal = normals[i];
+        Vector3 tangent = tangents[i] - normal*Math::dot(normal, tangents[i]);
+        /* If there's nothing to derive the tangent from, pick an arbitrary
+           direction perpendicular to the normal */
+        if(tangent.dot() < Math::TypeTraits<Float>::epsilon())
+            tangent = Math::cross(normal, Math::abs(normal.x()) < 0.9f ? Vector3::xAxis() : Vector3::yAxis());
+        tangent = tangent.normalized();
+        out[i] = Vector4{tangent, Math::dot(Math::cross(normal, tangent), bitangents[i]) < 0.0f ? -1.0f : 1.0f};
+    }
+
+    return out;
+}
+
+/* Common checks for the post-transform vertex cache APIs */
+void checkIndexedTriangles(const Trade::MeshData& mesh, const UnsignedInt cacheSize) {
+    if(!mesh.isIndexed()) {
+        PyErr_SetString(PyExc_AssertionError, "the mesh is not indexed");
+        throw py::error_already_set{};
+    }
+    if(mesh.primitive() != MeshPrimitive::Triangles) {
+        PyErr_Format(PyExc_AssertionError, "expected %S but got %S", py::cast(MeshPrimitive::Triangles).ptr(), py::cast(mesh.primitive()).ptr());
+        throw py::error_already_set{};
+    }
+    if(mesh.indexCount() % 3) {
+        PyErr_Format(PyExc_AssertionError, "expected index count to be divisible by 3, got %u", mesh.indexCount());
+        throw py::error_already_set{};
+    }
+    if(!cacheSize) {
+        PyErr_SetString(PyExc_AssertionError, "expected a non-zero cache size");
+        throw py::error_already_set{};
+    }
+    /** @todo check that the indices aren't impl-specific once it's possible
+        to test */
+}
+
+/* Common checks for the bounding volume APIs */
+void checkBoundingVolumePositions(const Trade::MeshData& mesh, const UnsignedInt id, const Int morphTargetId) {
+    if(!mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId)) {
+        if(morphTargetId == -1)
+            PyErr_Format(PyExc_KeyError, "the mesh has no positions with index %u", id);
+        else
+            PyErr_Format(PyExc_KeyError, "the mesh has no positions with index %u in morph target %i", id, morphTargetId);
+        throw py::error_already_set{};
+    }
+    if(!mesh.vertexCount()) {
+        PyErr_SetString(PyExc_AssertionError, "the mesh has no vertices");
+        throw py::error_already_set{};
+    }
+    /** @todo check that the positions aren't impl-specific once it's
+        possible to test */
+}
+
+/* Common checks for the concatenation APIs, `primitive` is the primitive of
+   the first mesh */
+void checkConcatenateMesh(const MeshPrimitive primitive, const Trade::MeshData& mesh, const std::size_t i) {
+    if(mesh.primitive() == MeshPrimitive::LineStrip ||
+       mesh.primitive() == MeshPrimitive::LineLoop ||
+       mesh.primitive() == MeshPrimitive::TriangleStrip ||
+       mesh.primitive() == MeshPrimitive::TriangleFan)
+    {
+        PyErr_Format(PyExc_AssertionError, "%S is not supported, turn it into a plain indexed mesh first", py::cast(mesh.primitive()).ptr());
+        throw py::error_already_set{};
+    }
+    if(mesh.primitive() != primitive) {
+        PyErr_Format(PyExc_AssertionError, "expected %S but got %S in mesh %zu", py::cast(primitive).ptr(), py::cast(mesh.primitive()).ptr(), i);
+        throw py::error_already_set{};
+    }
+    /** @todo check that the indices/Vertices aren't impl-specific once it's
+        possible to test */
+    /** @todo there's a lot more assertions re attribute formats, array sizes,
+        etc */
+}
+
+Containers::Iterable<const Trade::MeshData> meshIterable(const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes) {
+    return Containers::Iterable<const Trade::MeshData>{meshes.data(), meshes.size(), sizeof(std::reference_wrapper<Trade::MeshData>), [](const void* data) -> const Trade::MeshData& {
+        return static_cast<const std::reference_wrapper<Trade::MeshData>*>(data)->get();
+    }};
+}
+
+/* Collects meshes for concatenation. The appended meshes are referenced until
+   finalized, both lists are only cleared and not deallocated in order to
+   reuse the capacity in subsequent uses. The finalized meshes are referenced
+   as well, and once nothing else references them anymore, their storage is
+   reused for subsequent finalize() calls. */
+struct MeshConcatenator {
+    std::vector<py::object> objects;
+    std::vector<std::reference_wrapper<Trade::MeshData>> meshes;
+    std::vector<py::object> results;
+};
+
+void meshConcatenatorCheckNotEmpty(const MeshConcatenator& self) {
+    if(self.meshes.empty()) {
+        PyErr_SetString(PyExc_AssertionError, "no meshes appended");
+        throw py::error_already_set{};
+    }
+}
+
+void meshConcatenatorClear(MeshConcatenator& self) {
+    self.objects.clear();
+    self.meshes.clear();
+}
+
+}
+
 void meshtools(py::module_& m) {
     m.doc() = "Mesh tools";
 
@@ -74,7 +373,116 @@ void meshtools(py::module_& m) {
         .value("PRESERVE_STRIDED_INDICES", MeshTools::InterleaveFlag::PreserveStridedIndices);
     corrade::enumOperators(interleaveFlags);
 
+    py::class_<MeshConcatenator> meshConcatenator{m, "MeshConcatenator", "Incremental mesh concatenation"};
+    meshConcatenator
+        .def(py::init(), "Constructor")
+        .def("__len__", [](const MeshConcatenator& self) {
+            return self.meshes.size();
+        }, "Count of appended meshes")
+        .def("append", [](MeshConcatenator& self, Trade::MeshData& mesh) {
+            checkConcatenateMesh(self.meshes.empty() ? mesh.primitive() : self.meshes[0].get().primitive(), mesh, self.meshes.size());
+
+            self.objects.push_back(py::cast(mesh));
+            self.meshes.push_back(mesh);
+        }, "Append a mesh", py::arg("mesh"))
+        .def("clear", meshConcatenatorClear, "Clear the appended meshes")
+        .def("finalize", [](MeshConcatenator& self, MeshTools::InterleaveFlag flags) {
+            meshConcatenatorCheckNotEmpty(self);
+
+            /* If a previously finalized mesh is referenced only from here,
+               nothing else, not even a view on its data or a mesh referencing
+               it, can observe it anymore and so its storage can be reused.
+               Other such meshes aren't needed, release them. An appended mesh
+               is referenced from `objects`, so it never gets picked. */
+            py::object out;
+            for(std::size_t i = 0; i != self.results.size(); ) {
+                if(Py_REFCNT(self.results[i].ptr()) != 1) {
+                    ++i;
+                } else if(!out) {
+                    out = self.results[i];
+                    ++i;
+                } else self.results.erase(self.results.begin() + i);
+            }
+
+            if(out)
+                MeshTools::concatenateInto(py::cast<Trade::MeshData&>(out), meshIterable(self.meshes), flags);
+            else {
+                out = py::cast(MeshTools::concatenate(meshIterable(self.meshes), flags));
+                self.results.push_back(out);
+            }
+
+            meshConcatenatorClear(self);
+            return out;
+        }, "Concatenate the appended meshes together", py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes);
+
     m
+        .def("average_cache_miss_ratio", [](const Trade::MeshData& mesh, UnsignedInt cacheSize) {
+            checkIndexedTriangles(mesh, cacheSize);
+
+            return averageCacheMissRatio(mesh.indicesAsArray(), mesh.vertexCount(), cacheSize);
+        }, "Average post-transform vertex cache miss ratio", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("cache_size") = 24)
+        .def("bounding_range", [](const Trade::MeshData& mesh, UnsignedInt id, Int morphTargetId) {
+            checkBoundingVolumePositions(mesh, id, morphTargetId);
+
+            const Containers::Array<Vector3> positions = mesh.positions3DAsArray(id, morphTargetId);
+            return MeshTools::boundingRange(positions);
+        }, "Calculate an axis-aligned bounding box of mesh positions", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("id") = 0, py::arg("morph_target_id") = -1)
+        .def("bounding_range_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, UnsignedInt id, Int morphTargetId, UnsignedInt threadCount) {
+            for(std::size_t i = 0; i != meshes.size(); ++i) {
+                const Trade::MeshData& mesh = meshes[i];
+                if(!mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId)) {
+                    if(morphTargetId == -1)
+                        PyErr_Format(PyExc_KeyError, "mesh %zu has no positions with index %u", i, id);
+                    else
+                        PyErr_Format(PyExc_KeyError, "mesh %zu has no positions with index %u in morph target %i", i, id, morphTargetId);
+                    throw py::error_already_set{};
+                }
+                if(!mesh.vertexCount()) {
+                    PyErr_Format(PyExc_AssertionError, "mesh %zu has no vertices", i);
+                    throw py::error_already_set{};
+                }
+                /** @todo check that the positions aren't impl-specific once
+                    it's possible to test */
+            }
+
+            Containers::Array<Range3D> out{NoInit, meshes.size()};
+            {
+                py::gil_scoped_release release;
+                parallelFor(meshes.size(), threadCount, [&](const std::size_t i) {
+                    const Containers::Array<Vector3> positions = meshes[i].get().positions3DAsArray(id, morphTargetId);
+                    out[i] = MeshTools::boundingRange(positions);
+                });
+            }
+
+            /* Expose as a N x 2 x 3 view, with the second dimension being the
+               min and max corner */
+            const Containers::StridedArrayView3D<Float> components = Containers::arrayCast<3, Float>(Containers::arrayCast<2, Vector3>(Containers::stridedArrayView(out)));
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<3, char>{components}, Containers::pyArrayOwner(std::move(out)));
+        }, "Calculate axis-aligned bounding boxes of positions in multiple meshes", py::arg("meshes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("id") = 0, py::arg("morph_target_id") = -1, py::arg("thread_count") = 0)
+        .def("bounding_sphere", [](const Trade::MeshData& mesh, UnsignedInt id, Int morphTargetId) {
+            checkBoundingVolumePositions(mesh, id, morphTargetId);
+
+            const Containers::Array<Vector3> positions = mesh.positions3DAsArray(id, morphTargetId);
+            const Containers::Pair<Vector3, Float> sphere = MeshTools::boundingSphereBouncingBubble(positions);
+            /** @todo bind Containers::Pair directly */
+            return py::make_tuple(sphere.first(), sphere.second());
+        }, "Calculate a bounding sphere of mesh positions", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("id") = 0, py::arg("morph_target_id") = -1)
         .def("compile", [](const Trade::MeshData& mesh, MeshTools::CompileFlag flags) {
             return MeshTools::compile(mesh, flags);
         }, "Compile 3D mesh data", py::arg("mesh"), py::arg("flags") = MeshTools::CompileFlag{})
@@ -92,6 +500,23 @@ void meshtools(py::module_& m) {
             py::kw_only{}, /* new in pybind11 2.6 */
             #endif
             py::arg("at_least") = MeshIndexType::UnsignedShort)
+        .def("compress_indices_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, MeshIndexType atLeast, UnsignedInt threadCount) {
+            for(std::size_t i = 0; i != meshes.size(); ++i) {
+                if(!meshes[i].get().isIndexed()) {
+                    PyErr_Format(PyExc_AssertionError, "mesh %zu is not indexed", i);
+                    throw py::error_already_set{};
+                }
+            }
+
+            return batch(meshes, threadCount, [atLeast](const Trade::MeshData& mesh) {
+                return MeshTools::compressIndices(mesh, atLeast);
+            });
+        }, "Compress indices of multiple meshes in parallel", py::arg("meshes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("at_least") = MeshIndexType::UnsignedShort,
+            py::arg("thread_count") = 0)
         /** @todo ew, expose Iterable directly */
         .def("concatenate", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, MeshTools::InterleaveFlag flags) {
             if(meshes.empty()) {
@@ -99,29 +524,10 @@ void meshtools(py::module_& m) {
                 throw py::error_already_set{};
             }
             const MeshPrimitive primitive = meshes[0].get().primitive();
-            for(std::size_t i = 0; i != meshes.size(); ++i) {
-                const Trade::MeshData& mesh = meshes[i];
-                if(mesh.primitive() == MeshPrimitive::LineStrip ||
-                   mesh.primitive() == MeshPrimitive::LineLoop ||
-                   mesh.primitive() == MeshPrimitive::TriangleStrip ||
-                   mesh.primitive() == MeshPrimitive::TriangleFan)
-                {
-                    PyErr_Format(PyExc_AssertionError, "%S is not supported, turn it into a plain indexed mesh first", py::cast(mesh.primitive()).ptr());
-                    throw py::error_already_set{};
-                }
-                if(mesh.primitive() != primitive) {
-                    PyErr_Format(PyExc_AssertionError, "expected %S but got %S in mesh %zu", py::cast(primitive).ptr(), py::cast(mesh.primitive()).ptr(), i);
-                    throw py::error_already_set{};
-                }
-            }
-            /** @todo check that the indices/Vertices aren't impl-specific once
-                it's possible to test */
-            /** @todo there's a lot more assertions re attribute formats, array
-                sizes, etc */
+            for(std::size_t i = 0; i != meshes.size(); ++i)
+                checkConcatenateMesh(primitive, meshes[i], i);
 
-            return MeshTools::concatenate(Containers::Iterable<const Trade::MeshData>{meshes.data(), meshes.size(), sizeof(std::reference_wrapper<Trade::MeshData>), [](const void* data) -> const Trade::MeshData& {
-                return static_cast<const std::reference_wrapper<Trade::MeshData>*>(data)->get();
-            }}, flags);
+            return MeshTools::concatenate(meshIterable(meshes), flags);
         }, "Concatenate meshes together", py::arg("meshes"), py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
         .def("duplicate", [](const Trade::MeshData& mesh) {
             if(!mesh.isIndexed()) {
@@ -170,6 +576,105 @@ void meshtools(py::module_& m) {
 
             return MeshTools::generateIndices(mesh);
         }, "Convert a mesh to plain indexed lines or triangles", py::arg("mesh"))
+        .def("generate_indices_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, UnsignedInt threadCount) {
+            for(std::size_t i = 0; i != meshes.size(); ++i) {
+                const MeshPrimitive primitive = meshes[i].get().primitive();
+                if(primitive != MeshPrimitive::LineStrip &&
+                   primitive != MeshPrimitive::LineLoop &&
+                   primitive != MeshPrimitive::TriangleStrip &&
+                   primitive != MeshPrimitive::TriangleFan)
+                {
+                    PyErr_Format(PyExc_AssertionError, "invalid primitive %S in mesh %zu", py::cast(primitive).ptr(), i);
+                    throw py::error_already_set{};
+                }
+            }
+
+            return batch(meshes, threadCount, [](const Trade::MeshData& mesh) {
+                return MeshTools::generateIndices(mesh);
+            });
+        }, "Convert multiple meshes to plain indexed lines or triangles in parallel", py::arg("meshes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("thread_count") = 0)
+        .def("generate_flat_normals", [](const Trade::MeshData& mesh, MeshTools::InterleaveFlag flags) {
+            checkTriangles3D(mesh);
+
+            /* Drop the existing normals to not have them duplicated
+               needlessly */
+            const Trade::MeshData withoutNormals = MeshTools::filterExceptAttributes(mesh, {Trade::MeshAttribute::Normal});
+            if(!mesh.isIndexed()) {
+                const Containers::Array<Vector3> positions = withoutNormals.positions3DAsArray();
+                const Containers::Array<Vector3> normals = MeshTools::generateFlatNormals(Containers::stridedArrayView(positions));
+                return MeshTools::interleave(withoutNormals, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+                }, flags);
+            }
+
+            /* Flat normals need each triangle to have its own vertices */
+            for(const UnsignedInt index: mesh.indicesAsArray())
+                checkIndexInRange(index, mesh.vertexCount());
+            const Trade::MeshData duplicated = MeshTools::duplicate(withoutNormals);
+            const Containers::Array<Vector3> positions = duplicated.positions3DAsArray();
+            const Containers::Array<Vector3> normals = MeshTools::generateFlatNormals(Containers::stridedArrayView(positions));
+            return MeshTools::interleave(duplicated, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+            }, flags);
+        }, "Generate flat normals", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
+        .def("generate_smooth_normals", [](const Trade::MeshData& mesh, MeshTools::InterleaveFlag flags) {
+            if(!mesh.isIndexed()) {
+                PyErr_SetString(PyExc_AssertionError, "the mesh is not indexed");
+                throw py::error_already_set{};
+            }
+            checkTriangles3D(mesh);
+            const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+            for(const UnsignedInt index: indices)
+                checkIndexInRange(index, mesh.vertexCount());
+
+            const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+            const Containers::Array<Vector3> normals = MeshTools::generateSmoothNormals(Containers::stridedArrayView(indices), Containers::stridedArrayView(positions));
+            return MeshTools::interleave(MeshTools::filterExceptAttributes(mesh, {Trade::MeshAttribute::Normal}), {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+            }, flags);
+        }, "Generate smooth normals", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
+        .def("generate_tangents", [](const Trade::MeshData& mesh, MeshTools::InterleaveFlag flags) {
+            checkTriangles3D(mesh);
+            if(!mesh.hasAttribute(Trade::MeshAttribute::Normal)) {
+                PyErr_SetString(PyExc_KeyError, "the mesh has no normals");
+                throw py::error_already_set{};
+            }
+            if(!mesh.hasAttribute(Trade::MeshAttribute::TextureCoordinates)) {
+                PyErr_SetString(PyExc_KeyError, "the mesh has no texture coordinates");
+                throw py::error_already_set{};
+            }
+            const Containers::Array<UnsignedInt> indices = mesh.isIndexed() ?
+                mesh.indicesAsArray() :
+                MeshTools::generateTrivialIndices(mesh.vertexCount());
+            for(const UnsignedInt index: indices)
+                checkIndexInRange(index, mesh.vertexCount());
+
+            const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+            const Containers::Array<Vector3> normals = mesh.normalsAsArray();
+            const Containers::Array<Vector2> textureCoordinates = mesh.textureCoordinates2DAsArray();
+            const Containers::Array<Vector4> tangents = generateTangents(indices, positions, normals, textureCoordinates);
+            /* Bitangents are implied by the tangent handedness, drop them
+               together with existing tangents */
+            return MeshTools::interleave(MeshTools::filterExceptAttributes(mesh, {Trade::MeshAttribute::Tangent, Trade::MeshAttribute::Bitangent}), {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, Containers::arrayView(tangents)}
+            }, flags);
+        }, "Generate tangents", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
         /** @todo eugh, find a way w/o the STL vector */
         .def("interleave", [](const Trade::MeshData& mesh, const std::vector<Trade::MeshAttributeData>& extra, MeshTools::InterleaveFlag flags) {
             for(std::size_t i = 0; i != extra.size(); ++i) {
@@ -189,10 +694,41 @@ void meshtools(py::module_& m) {
             #endif
             py::arg("extra") = std::vector<Trade::MeshAttributeData>{},
             py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
+        .def("interleave_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, MeshTools::InterleaveFlag flags, UnsignedInt threadCount) {
+            return batch(meshes, threadCount, [flags](const Trade::MeshData& mesh) {
+                return MeshTools::interleave(mesh, Containers::ArrayView<const Trade::MeshAttributeData>{}, flags);
+            });
+        }, "Interleave multiple meshes in parallel", py::arg("meshes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes,
+            py::arg("thread_count") = 0)
         .def("copy", static_cast<Trade::MeshData(*)(const Trade::MeshData&)>(MeshTools::copy), "Make an owned copy of the mesh", py::arg("mesh"))
+        .def("optimize_vertex_fetch", [](const Trade::MeshData& mesh) {
+            if(!mesh.isIndexed()) {
+                PyErr_SetString(PyExc_AssertionError, "the mesh is not indexed");
+                throw py::error_already_set{};
+            }
+            /** @todo check that the indices/vertices aren't impl-specific
+                once it's possible to test */
+
+            return optimizeVertexFetch(mesh);
+        }, "Reorder mesh vertices for vertex fetch efficiency", py::arg("mesh"))
         /** @todo check that the indices/vertices aren't impl-specific once
             it's possible to test */
         .def("remove_duplicates", static_cast<Trade::MeshData(*)(const Trade::MeshData&)>(MeshTools::removeDuplicates), "Remove mesh data duplicates", py::arg("mesh"))
+        /** @todo check that the indices/vertices aren't impl-specific once
+            it's possible to test */
+        .def("remove_duplicates_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, UnsignedInt threadCount) {
+            return batch(meshes, threadCount, [](const Trade::MeshData& mesh) {
+                return MeshTools::removeDuplicates(mesh);
+            });
+        }, "Remove duplicates from multiple meshes in parallel", py::arg("meshes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("thread_count") = 0)
         /** @todo check that the indices/vertices aren't impl-specific once
             it's possible to test */
         .def("remove_duplicates_fuzzy", MeshTools::removeDuplicatesFuzzy, "Remove mesh data duplicates", py::arg("mesh"),
@@ -201,6 +737,34 @@ void meshtools(py::module_& m) {
             #endif
             py::arg("float_epsilon") = Math::TypeTraits<Float>::epsilon(),
             py::arg("double_epsilon") = Math::TypeTraits<Double>::epsilon())
+        .def("tipsify_in_place", [](Trade::MeshData& mesh, UnsignedInt cacheSize) {
+            checkIndexedTriangles(mesh, cacheSize);
+            if(!(mesh.indexDataFlags() & Trade::DataFlag::Mutable)) {
+                PyErr_SetString(PyExc_AssertionError, "index data not mutable");
+                throw py::error_already_set{};
+            }
+            /* The indices are used to index per-vertex arrays internally, so
+               out-of-range values would write out of bounds */
+            for(const UnsignedInt index: mesh.indicesAsArray())
+                checkIndexInRange(index, mesh.vertexCount());
+
+            switch(mesh.indexType()) {
+                case MeshIndexType::UnsignedByte:
+                    MeshTools::tipsifyInPlace(mesh.mutableIndices<UnsignedByte>(), mesh.vertexCount(), cacheSize);
+                    break;
+                case MeshIndexType::UnsignedShort:
+                    MeshTools::tipsifyInPlace(mesh.mutableIndices<UnsignedShort>(), mesh.vertexCount(), cacheSize);
+                    break;
+                case MeshIndexType::UnsignedInt:
+                    MeshTools::tipsifyInPlace(mesh.mutableIndices<UnsignedInt>(), mesh.vertexCount(), cacheSize);
+                    break;
+                default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            }
+        }, "Tipsify the mesh indices in-place", py::arg("mesh"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("cache_size") = 24)
         .def("transform2d", [](const Trade::MeshData& mesh, const Matrix3& transformation, UnsignedInt id, Int morphTargetId, MeshTools::InterleaveFlag flags) {
             const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId);
             if(!positionAttributeId) {
@@ -270,6 +834,34 @@ void meshtools(py::module_& m) {
             py::kw_only{}, /* new in pybind11 2.6 */
             #endif
             py::arg("id") = 0, py::arg("morph_target_id") = -1, py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes)
+        .def("transform3d_batch", [](const std::vector<std::reference_wrapper<Trade::MeshData>>& meshes, const Matrix4& transformation, UnsignedInt id, Int morphTargetId, MeshTools::InterleaveFlag flags, UnsignedInt threadCount) {
+            for(std::size_t i = 0; i != meshes.size(); ++i) {
+                const Trade::MeshData& mesh = meshes[i];
+                const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId);
+                if(!positionAttributeId) {
+                    if(morphTargetId == -1)
+                        PyErr_Format(PyExc_KeyError, "mesh %zu has no positions with index %u", i, id);
+                    else
+                        PyErr_Format(PyExc_KeyError, "mesh %zu has no positions with index %u in morph target %i", i, id, morphTargetId);
+                    throw py::error_already_set{};
+                }
+                if(vertexFormatComponentCount(mesh.attributeFormat(*positionAttributeId)) != 3) {
+                    PyErr_Format(PyExc_AssertionError, "expected 3D positions but got %S in mesh %zu", py::cast(mesh.attributeFormat(*positionAttributeId)).ptr(), i);
+                    throw py::error_already_set{};
+                }
+            }
+            /** @todo check that the positions, normals, ... aren't
+                impl-specific once it's possible to test */
+
+            return batch(meshes, threadCount, [&transformation, id, morphTargetId, flags](const Trade::MeshData& mesh) {
+                return MeshTools::transform3D(mesh, transformation, id, morphTargetId, flags);
+            });
+        }, "Transform 3D positions, normals, tangents and bitangents in multiple meshes in parallel", py::arg("meshes"), py::arg("transformation"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("id") = 0, py::arg("morph_target_id") = -1, py::arg("flags") = MeshTools::InterleaveFlag::PreserveInterleavedAttributes,
+            py::arg("thread_count") = 0)
         .def("transform3d_in_place", [](Trade::MeshData& mesh, const Matrix4& transformation, UnsignedInt id, Int morphTargetId) {
             if(!(mesh.vertexDataFlags() & Trade::DataFlag::Mutable)) {
                 PyErr_SetString(PyExc_AssertionError, "vertex data not mutable");
@@ -24,13 +24,20 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h> /* for std::vector */
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Magnum/Math/Matrix3.h>
 #include <Magnum/Math/Matrix4.h>
 #include <Magnum/SceneTools/Combine.h>
@@ -39,12 +46,282 @@
 #include <Magnum/Trade/SceneData.h>
 
 #include "Corrade/PythonBindings.h"
+#include "Corrade/Containers/ArrayPythonBindings.h"
 #include "Magnum/Trade/PythonBindings.h"
 
 #include "magnum/bootstrap.h"
 
 namespace magnum {
 
+namespace {
+
+/* Exposes an array of matrices as a three-dimensional view owning the
+   memory, with the second and third dimension being rows and columns, i.e.
+   the same order as the buffer protocol of the matrix types uses */
+template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<3, char>> matrixArrayView(Containers::Array<T>&& matrices) {
+    /* The matrices are stored column-major, flip the two last dimensions to
+       get rows first */
+    const Containers::StridedArrayView3D<typename T::Type> components = Containers::arrayCast<3, typename T::Type>(Containers::arrayCast<2, Math::Vector<T::Rows, typename T::Type>>(Containers::stridedArrayView(matrices))).template transposed<1, 2>();
+    return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<3, char>{components}, Containers::pyArrayOwner(std::move(matrices)));
+}
+
+/* Item accessors for arrays of integer pairs, which are exposed as tuples */
+template<class T, class U> py::object pairGetitem(const char* item) {
+    const std::pair<T, U>& pair = *reinterpret_cast<const std::pair<T, U>*>(item);
+    return py::make_tuple(pair.first, pair.second);
+}
+template<class T, class U> void pairSetitem(char* item, py::handle object) {
+    *reinterpret_cast<std::pair<T, U>*>(item) = py::cast<std::pair<T, U>>(object);
+}
+
+enum class StringFieldKind {
+    Offset,
+    Range,
+    RangeNullTerminated
+};
+
+/* Size of a single offset / size value of a string field type and how the
+   values are interpreted */
+Containers::Pair<std::size_t, StringFieldKind> stringFieldTypeProperties(const Trade::SceneFieldType type) {
+    switch(type) {
+        #define _c(type, size, kind) case Trade::SceneFieldType::type: return {size, StringFieldKind::kind};
+        _c(StringOffset8, 1, Offset)
+        _c(StringOffset16, 2, Offset)
+        _c(StringOffset32, 4, Offset)
+        _c(StringOffset64, 8, Offset)
+        _c(StringRange8, 1, Range)
+        _c(StringRange16, 2, Range)
+        _c(StringRange32, 4, Range)
+        _c(StringRange64, 8, Range)
+        _c(StringRangeNullTerminated8, 1, RangeNullTerminated)
+        _c(StringRangeNullTerminated16, 2, RangeNullTerminated)
+        _c(StringRangeNullTerminated32, 4, RangeNullTerminated)
+        _c(StringRangeNullTerminated64, 8, RangeNullTerminated)
+        #undef _c
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+template<class T> bool writeStringFieldValue(char* const to, const std::size_t value) {
+    if(value > T(~T{})) return false;
+    const T valueT = value;
+    std::memcpy(to, &valueT, sizeof(T));
+    return true;
+}
+
+bool writeStringFieldValue(char* const to, const std::size_t size, const std::size_t value) {
+    switch(size) {
+        case 1: return writeStringFieldValue<UnsignedByte>(to, value);
+        case 2: return writeStringFieldValue<UnsignedShort>(to, value);
+        case 4: return writeStringFieldValue<UnsignedInt>(to, value);
+        case 8: return writeStringFieldValue<UnsignedLong>(to, value);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+std::size_t alignTo8(const std::size_t offset) {
+    return (offset + 7) & ~std::size_t{7};
+}
+
+/* A field with no mask is kept in full, so it's equal to an all-ones mask */
+bool masksEqual(const Containers::Optional<Containers::BitArrayView>& a, const Containers::Optional<Containers::BitArrayView>& b, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        if((!a || (*a)[i]) != (!b || (*b)[i])) return false;
+    return true;
+}
+
+/* SceneTools::filterFieldEntries() doesn't support filtering bit and string
+   fields yet, so if any of those is filtered, the whole scene is rebuilt
+   here instead. Fields with no mask are copied in full. Same as in the
+   SceneTools implementation, fields sharing the same mapping in the input
+   share it in the output as well, which SceneData requires for TRS and
+   mesh/material fields. */
+Trade::SceneData filterFieldEntriesWithBitsStrings(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Optional<Containers::BitArrayView>> entriesToKeep) {
+    CORRADE_INTERNAL_ASSERT(entriesToKeep.size() == scene.fieldCount());
+    const std::size_t mappingTypeSize = Trade::sceneMappingTypeSize(scene.mappingType());
+
+    /* Find the first field with the same mapping view for each field. Such
+       fields have to be filtered the same way, as the filtered mapping is
+       written just once. */
+    Containers::Array<UnsignedInt> mappingShared{NoInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
+        mappingShared[i] = i;
+        for(UnsignedInt j = 0; j != i; ++j) {
+            const Containers::StridedArrayView2D<const char> otherMapping = scene.mapping(j);
+            if(mapping.data() != otherMapping.data() || mapping.size()[0] != otherMapping.size()[0] || mapping.stride()[0] != otherMapping.stride()[0])
+                continue;
+
+            if(!masksEqual(entriesToKeep[i], entriesToKeep[j], mapping.size()[0])) {
+                PyErr_Format(PyExc_AssertionError, "field %u shares mapping with field %u but was filtered differently", i, j);
+                throw py::error_already_set{};
+            }
+            mappingShared[i] = j;
+            break;
+        }
+    }
+
+    /* Calculate the output layout first, for strings it means concatenating
+       all strings that are kept */
+    struct Layout {
+        std::size_t size, mappingOffset, fieldOffset, stringOffset;
+    };
+    Containers::Array<Layout> layout{NoInit, scene.fieldCount()};
+    std::size_t dataSize = 0;
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::Optional<Containers::BitArrayView>& mask = entriesToKeep[i];
+        const std::size_t size = mask ? mask->count() : scene.fieldSize(i);
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        const std::size_t arraySize = scene.fieldArraySize(i) ? scene.fieldArraySize(i) : 1;
+
+        layout[i].size = size;
+        if(mappingShared[i] == i) {
+            layout[i].mappingOffset = alignTo8(dataSize);
+            dataSize = layout[i].mappingOffset + size*mappingTypeSize;
+        } else layout[i].mappingOffset = layout[mappingShared[i]].mappingOffset;
+        layout[i].fieldOffset = alignTo8(dataSize);
+        layout[i].stringOffset = 0;
+        if(fieldType == Trade::SceneFieldType::Bit) {
+            dataSize = layout[i].fieldOffset + (size*arraySize + 7)/8;
+        } else if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+            dataSize = layout[i].fieldOffset + size*Trade::sceneFieldTypeSize(fieldType);
+            layout[i].stringOffset = dataSize;
+            const StringFieldKind kind = stringFieldTypeProperties(fieldType).second();
+            const bool nullTerminated = kind == StringFieldKind::RangeNullTerminated || (kind == StringFieldKind::Range && scene.fieldFlags(i) >= Trade::SceneFieldFlag::NullTerminatedString);
+            const Containers::StringIterable strings = scene.fieldStrings(i);
+            for(std::size_t j = 0; j != strings.size(); ++j)
+                if(!mask || (*mask)[j])
+                    dataSize += strings[j].size() + (nullTerminated ? 1 : 0);
+        } else {
+            dataSize = layout[i].fieldOffset + size*Trade::sceneFieldTypeSize(fieldType)*arraySize;
+        }
+    }
+
+    /* Copy the data and create offset-only fields referencing them */
+    Containers::Array<char> data{ValueInit, dataSize};
+    Containers::Array<Trade::SceneFieldData> fields{NoInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::Optional<Containers::BitArrayView>& mask = entriesToKeep[i];
+        const Trade::SceneField name = scene.fieldName(i);
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        const UnsignedShort fieldArraySize = scene.fieldArraySize(i);
+        const std::size_t arraySize = fieldArraySize ? fieldArraySize : 1;
+
+        /* Filtering makes the mapping no longer implicit, but it stays
+           ordered */
+        Trade::SceneFieldFlags flags = scene.fieldFlags(i) & ~Trade::SceneFieldFlag::OffsetOnly;
+        if(mask && flags >= Trade::SceneFieldFlag::ImplicitMapping)
+            flags = (flags & ~Trade::SceneFieldFlag::ImplicitMapping)|Trade::SceneFieldFlag::OrderedMapping;
+
+        /* Shared mappings are copied just for the first field */
+        if(mappingShared[i] == i) {
+            const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
+            for(std::size_t j = 0, k = 0; j != mapping.size()[0]; ++j) {
+                if(mask && !(*mask)[j]) continue;
+                Utility::copy(mapping[j], Containers::StridedArrayView1D<char>{data.sliceSize(layout[i].mappingOffset + k*mappingTypeSize, mappingTypeSize)});
+                ++k;
+            }
+        }
+
+        if(fieldType == Trade::SceneFieldType::Bit) {
+            const Containers::MutableBitArrayView out{data.data() + layout[i].fieldOffset, 0, layout[i].size*arraySize};
+            if(fieldArraySize) {
+                const Containers::StridedBitArrayView2D bits = scene.fieldBitArrays(i);
+                for(std::size_t j = 0, k = 0; j != bits.size()[0]; ++j) {
+                    if(mask && !(*mask)[j]) continue;
+                    for(std::size_t l = 0; l != arraySize; ++l)
+                        if(bits[j][l]) out.set(k*arraySize + l);
+                    ++k;
+                }
+            } else {
+                const Containers::StridedBitArrayView1D bits = scene.fieldBits(i);
+                for(std::size_t j = 0, k = 0; j != bits.size(); ++j) {
+                    if(mask && !(*mask)[j]) continue;
+                    if(bits[j]) out.set(k);
+                    ++k;
+                }
+            }
+
+            new(&fields[i]) Trade::SceneFieldData{name, layout[i].size, scene.mappingType(), layout[i].mappingOffset, std::ptrdiff_t(mappingTypeSize), layout[i].fieldOffset, 0, std::ptrdiff_t(arraySize), fieldArraySize, flags};
+
+        } else if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+            const Containers::Pair<std::size_t, StringFieldKind> properties = stringFieldTypeProperties(fieldType);
+            const std::size_t fieldTypeSize = Trade::sceneFieldTypeSize(fieldType);
+            /* Strings in offset fields are expected to be contiguous, so
+               the null terminators are dropped for these */
+            const bool nullTerminated = properties.second() == StringFieldKind::RangeNullTerminated || (properties.second() == StringFieldKind::Range && flags >= Trade::SceneFieldFlag::NullTerminatedString);
+            if(properties.second() == StringFieldKind::Offset)
+                flags &= ~Trade::SceneFieldFlag::NullTerminatedString;
+
+            const Containers::StringIterable strings = scene.fieldStrings(i);
+            std::size_t stringOffset = 0;
+            for(std::size_t j = 0, k = 0; j != strings.size(); ++j) {
+                if(mask && !(*mask)[j]) continue;
+                const Containers::StringView string = strings[j];
+                std::memcpy(data.data() + layout[i].stringOffset + stringOffset, string.data(), string.size());
+
+                char* const entry = data.data() + layout[i].fieldOffset + k*fieldTypeSize;
+                bool fits;
+                if(properties.second() == StringFieldKind::Offset)
+                    fits = writeStringFieldValue(entry, properties.first(), stringOffset + string.size());
+                else if(properties.second() == StringFieldKind::Range)
+                    fits = writeStringFieldValue(entry, properties.first(), stringOffset) &&
+                           writeStringFieldValue(entry + properties.first(), properties.first(), string.size());
+                else
+                    fits = writeStringFieldValue(entry, properties.first(), stringOffset);
+                /* Offset fields only ever get smaller when filtered, but
+                   ranges may have pointed to deduplicated strings before */
+                if(!fits) {
+                    PyErr_Format(PyExc_AssertionError, "filtered strings of field %u don't fit into %S", i, py::cast(fieldType).ptr());
+                    throw py::error_already_set{};
+                }
+
+                /* The data were zero-initialized, so the null terminator is
+                   there already */
+                stringOffset += string.size() + (nullTerminated ? 1 : 0);
+                ++k;
+            }
+
+            new(&fields[i]) Trade::SceneFieldData{name, layout[i].size, scene.mappingType(), layout[i].mappingOffset, std::ptrdiff_t(mappingTypeSize), layout[i].stringOffset, fieldType, layout[i].fieldOffset, std::ptrdiff_t(fieldTypeSize), flags};
+
+        } else {
+            const Containers::StridedArrayView2D<const char> field = scene.field(i);
+            const std::size_t itemSize = field.size()[1];
+            for(std::size_t j = 0, k = 0; j != field.size()[0]; ++j) {
+                if(mask && !(*mask)[j]) continue;
+                Utility::copy(field[j], Containers::StridedArrayView1D<char>{data.sliceSize(layout[i].fieldOffset + k*itemSize, itemSize)});
+                ++k;
+            }
+
+            new(&fields[i]) Trade::SceneFieldData{name, layout[i].size, scene.mappingType(), layout[i].mappingOffset, std::ptrdiff_t(mappingTypeSize), fieldType, layout[i].fieldOffset, std::ptrdiff_t(itemSize), fieldArraySize, flags};
+        }
+    }
+
+    return Trade::SceneData{scene.mappingType(), scene.mappingBound(), std::move(data), std::move(fields)};
+}
+
+/* Delegates to SceneTools::filterFieldEntries() unless a bit or a string
+   field is among the filtered ones */
+template<class T> Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<T, Containers::BitArrayView>> entriesToKeep, const Containers::ArrayView<const UnsignedInt> fieldIds) {
+    bool hasBitsStrings = false;
+    for(const UnsignedInt fieldId: fieldIds) {
+        const Trade::SceneFieldType fieldType = scene.fieldType(fieldId);
+        if(fieldType == Trade::SceneFieldType::Bit || Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+            hasBitsStrings = true;
+            break;
+        }
+    }
+    if(!hasBitsStrings)
+        return SceneTools::filterFieldEntries(scene, entriesToKeep);
+
+    Containers::Array<Containers::Optional<Containers::BitArrayView>> masks{scene.fieldCount()};
+    for(std::size_t i = 0; i != entriesToKeep.size(); ++i)
+        masks[fieldIds[i]] = entriesToKeep[i].second();
+    return filterFieldEntriesWithBitsStrings(scene, masks);
+}
+
+}
+
 void scenetools(py::module_& m) {
     m.doc() = "Scene manipulation and optimization tools";
 
@@ -88,6 +365,7 @@ void scenetools(py::module_& m) {
         .def("filter_field_entries", [](const Trade::SceneData& scene, const std::vector<std::pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeepStl) {
             const auto entriesToKeep = Containers::arrayCast<const Containers::Pair<Trade::SceneField, Containers::BitArrayView>>(Containers::arrayView(entriesToKeepStl));
             Containers::BitArray usedFields{ValueInit, scene.fieldCount()};
+            Containers::Array<UnsignedInt> fieldIds{NoInit, entriesToKeep.size()};
             for(std::size_t i = 0; i != entriesToKeep.size(); ++i) {
                 const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(entriesToKeep[i].first());
                 if(!fieldId) {
@@ -104,25 +382,18 @@ void scenetools(py::module_& m) {
                     PyErr_Format(PyExc_AssertionError, "expected %zu bits for field at index %zu but got %zu", scene.fieldSize(*fieldId), i, mask.size());
                     throw py::error_already_set{};
                 }
-                const Trade::SceneFieldType fieldType = scene.fieldType(*fieldId);
-                if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
-                    PyErr_SetString(PyExc_NotImplementedError, "filtering string fields is not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                if(fieldType == Trade::SceneFieldType::Bit) {
-                    PyErr_SetString(PyExc_NotImplementedError, "filtering bit fields is not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
+                fieldIds[i] = *fieldId;
             }
             /** @todo check field sharing as well to avoid an assertion --
                 make an internal helper in SceneTools or some such, it makes no
                 sense to duplicate the whole logic here */
 
-            return SceneTools::filterFieldEntries(scene, entriesToKeep);
+            return filterFieldEntries(scene, entriesToKeep, fieldIds);
         }, "Filter individual entries of named fields in a scene", py::arg("scene"), py::arg("entries_to_keep"))
         .def("filter_field_entries", [](const Trade::SceneData& scene, const std::vector<std::pair<UnsignedInt, Containers::BitArrayView>> entriesToKeepStl) {
             const auto entriesToKeep = Containers::arrayCast<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>(Containers::arrayView(entriesToKeepStl));
             Containers::BitArray usedFields{ValueInit, scene.fieldCount()};
+            Containers::Array<UnsignedInt> fieldIds{NoInit, entriesToKeep.size()};
             for(std::size_t i = 0; i != entriesToKeep.size(); ++i) {
                 const UnsignedInt fieldId = entriesToKeep[i].first();
                 if(fieldId >= scene.fieldCount()) {
@@ -139,32 +410,54 @@ void scenetools(py::module_& m) {
                     PyErr_Format(PyExc_AssertionError, "expected %zu bits for field %u but got %zu", scene.fieldSize(fieldId), fieldId, mask.size());
                     throw py::error_already_set{};
                 }
-                const Trade::SceneFieldType fieldType = scene.fieldType(fieldId);
-                if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
-                    PyErr_SetString(PyExc_NotImplementedError, "filtering string fields is not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                if(fieldType == Trade::SceneFieldType::Bit) {
-                    PyErr_SetString(PyExc_NotImplementedError, "filtering bit fields is not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
+                fieldIds[i] = fieldId;
             }
             /** @todo check field sharing as well to avoid an assertion --
                 make an internal helper in SceneTools or some such, it makes no
                 sense to duplicate the whole logic here */
 
-            return SceneTools::filterFieldEntries(scene, entriesToKeep);
+            return filterFieldEntries(scene, entriesToKeep, fieldIds);
         }, "Filter individual entries of fields in a scene", py::arg("scene"), py::arg("entries_to_keep"))
         .def("filter_objects", [](const Trade::SceneData& scene, const Containers::BitArrayView objectsToKeep) {
             if(objectsToKeep.size() != scene.mappingBound()) {
                 PyErr_Format(PyExc_AssertionError, "expected %llu bits but got %zu", scene.mappingBound(), objectsToKeep.size());
                 throw py::error_already_set{};
             }
-            /** @todo this will blow up if any objects have a bit / string
-                field, implement that already so it's not needed to check
-                here */
+            /* SceneTools::filterObjects() can't filter bit and string fields
+               yet, so if any of their entries would be removed, calculate
+               the masks for all fields and rebuild the scene here instead.
+               If there are no such fields, go directly to SceneTools to not
+               calculate the masks twice. */
+            bool hasBitsStrings = false;
+            for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+                const Trade::SceneFieldType fieldType = scene.fieldType(i);
+                if(fieldType == Trade::SceneFieldType::Bit || Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+                    hasBitsStrings = true;
+                    break;
+                }
+            }
+            if(!hasBitsStrings)
+                return SceneTools::filterObjects(scene, objectsToKeep);
+
+            Containers::Array<Containers::BitArray> masks{scene.fieldCount()};
+            bool filtersBitsStrings = false;
+            for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+                const Containers::Array<UnsignedInt> mapping = scene.mappingAsArray(i);
+                masks[i] = Containers::BitArray{ValueInit, mapping.size()};
+                for(std::size_t j = 0; j != mapping.size(); ++j)
+                    if(objectsToKeep[mapping[j]]) masks[i].set(j);
+
+                const Trade::SceneFieldType fieldType = scene.fieldType(i);
+                if((fieldType == Trade::SceneFieldType::Bit || Trade::Implementation::isSceneFieldTypeString(fieldType)) && masks[i].count() != masks[i].size())
+                    filtersBitsStrings = true;
+            }
+            if(!filtersBitsStrings)
+                return SceneTools::filterObjects(scene, objectsToKeep);
 
-            return SceneTools::filterObjects(scene, objectsToKeep);
+            Containers::Array<Containers::Optional<Containers::BitArrayView>> maskViews{scene.fieldCount()};
+            for(UnsignedInt i = 0; i != scene.fieldCount(); ++i)
+                maskViews[i] = Containers::BitArrayView{masks[i]};
+            return filterFieldEntriesWithBitsStrings(scene, maskViews);
         }, "Filter objects in a scene", py::arg("scene"), py::arg("objects_to_keep"))
         .def("parents_breadth_first", [](const Trade::SceneData& scene) {
             const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
@@ -173,12 +466,11 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo ugh, add type converters for Corrade arrays already */
-            std::vector<std::pair<UnsignedInt, Int>> out{scene.fieldSize(*parentFieldId)};
+            Containers::Array<std::pair<UnsignedInt, Int>> out{NoInit, scene.fieldSize(*parentFieldId)};
             SceneTools::parentsBreadthFirstInto(scene,
-                Containers::stridedArrayView(out).slice(&decltype(out)::value_type::first),
-                Containers::stridedArrayView(out).slice(&decltype(out)::value_type::second));
-            return out;
+                Containers::stridedArrayView(out).slice(&std::pair<UnsignedInt, Int>::first),
+                Containers::stridedArrayView(out).slice(&std::pair<UnsignedInt, Int>::second));
+            return Containers::pyOwnedArrayView(std::move(out), "Ii", pairGetitem<UnsignedInt, Int>, pairSetitem<UnsignedInt, Int>);
         }, "Retrieve parents in a breadth-first order", py::arg("scene"))
         .def("children_depth_first", [](const Trade::SceneData& scene) {
             const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
@@ -187,12 +479,11 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo ugh, add type converters for Corrade arrays already */
-            std::vector<std::pair<UnsignedInt, UnsignedInt>> out{scene.fieldSize(*parentFieldId)};
+            Containers::Array<std::pair<UnsignedInt, UnsignedInt>> out{NoInit, scene.fieldSize(*parentFieldId)};
             SceneTools::childrenDepthFirstInto(scene,
-                Containers::stridedArrayView(out).slice(&decltype(out)::value_type::first),
-                Containers::stridedArrayView(out).slice(&decltype(out)::value_type::second));
-            return out;
+                Containers::stridedArrayView(out).slice(&std::pair<UnsignedInt, UnsignedInt>::first),
+                Containers::stridedArrayView(out).slice(&std::pair<UnsignedInt, UnsignedInt>::second));
+            return Containers::pyOwnedArrayView(std::move(out), "II", pairGetitem<UnsignedInt, UnsignedInt>, pairSetitem<UnsignedInt, UnsignedInt>);
         }, "Retrieve children in a depth-first order", py::arg("scene"))
         .def("absolute_field_transformations2d", [](const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation) {
             const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
@@ -209,10 +500,9 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo maybe do a caster for arrays, finally?! */
-            std::vector<Matrix3> out(scene.fieldSize(*fieldId));
+            Containers::Array<Matrix3> out{NoInit, scene.fieldSize(*fieldId)};
             SceneTools::absoluteFieldTransformations2DInto(scene, *fieldId, out, globalTransformation);
-            return out;
+            return matrixArrayView(std::move(out));
         }, "Calculate absolute 2D transformations for given field", py::arg("scene"), py::arg("field"), py::arg("global_transformation") = Matrix3{})
         .def("absolute_field_transformations2d", [](const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation) {
             if(fieldId >= scene.fieldCount()) {
@@ -228,10 +518,9 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo maybe do a caster for arrays, finally?! */
-            std::vector<Matrix3> out(scene.fieldSize(fieldId));
+            Containers::Array<Matrix3> out{NoInit, scene.fieldSize(fieldId)};
             SceneTools::absoluteFieldTransformations2DInto(scene, fieldId, out, globalTransformation);
-            return out;
+            return matrixArrayView(std::move(out));
         }, "Calculate absolute 2D transformations for given named field", py::arg("scene"), py::arg("field_id"), py::arg("global_transformation") = Matrix3{})
         .def("absolute_field_transformations3d", [](const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation) {
             const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
@@ -248,10 +537,9 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo maybe do a caster for arrays, finally?! */
-            std::vector<Matrix4> out(scene.fieldSize(*fieldId));
+            Containers::Array<Matrix4> out{NoInit, scene.fieldSize(*fieldId)};
             SceneTools::absoluteFieldTransformations3DInto(scene, *fieldId, out, globalTransformation);
-            return out;
+            return matrixArrayView(std::move(out));
         }, "Calculate absolute 3D transformations for given field", py::arg("scene"), py::arg("field"), py::arg("global_transformation") = Matrix4{})
         .def("absolute_field_transformations3d", [](const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation) {
             if(fieldId >= scene.fieldCount()) {
@@ -267,11 +555,10 @@ void scenetools(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            /** @todo maybe do a caster for arrays, finally?! */
-            std::vector<Matrix4> out(scene.fieldSize(fieldId));
+            Containers::Array<Matrix4> out{NoInit, scene.fieldSize(fieldId)};
             SceneTools::absoluteFieldTransformations3DInto(scene, fieldId, out, globalTransformation);
-            return out;
-        }, "Calculate absolute 2D transformations for given named field", py::arg("scene"), py::arg("field_id"), py::arg("global_transformation") = Matrix4{});
+            return matrixArrayView(std::move(out));
+        }, "Calculate absolute 3D transformations for given named field", py::arg("scene"), py::arg("field_id"), py::arg("global_transformation") = Matrix4{});
 }
 
 }
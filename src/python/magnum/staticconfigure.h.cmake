@@ -27,6 +27,7 @@
 /* Named magnum/staticconfigure.h to avoid it colliding with Magnum/configure.h
    on case-insensitive filesystems */
 
+#cmakedefine Magnum_DebugTools_FOUND
 #cmakedefine Magnum_GL_FOUND
 #cmakedefine Magnum_MaterialTools_FOUND
 #cmakedefine Magnum_MeshTools_FOUND
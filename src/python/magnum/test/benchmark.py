@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021, 2022, 2023, 2024, 2025, 2026
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+# Benchmarks of the most common data-processing paths across modules. Prints
+# a table by default, with --json the results are saved in a machine-readable
+# form and with --compare they're checked against a previously saved run.
+# See benchmark_math.py for micro-benchmarks of the math types alone.
+
+# Avoid this being run implicitly during unit tests
+if __name__ != '__main__': exit()
+
+import argparse
+import json
+import os
+import platform
+import sys
+import timeit
+
+from corrade import containers, utility
+from magnum import *
+from magnum import math, meshtools, primitives, scenetools, trade
+import numpy as np
+
+parser = argparse.ArgumentParser(description="Cross-module bindings benchmark")
+parser.add_argument('--json', metavar='FILE', help="save results into a JSON file")
+parser.add_argument('--compare', metavar='FILE', help="compare against results saved with --json earlier")
+parser.add_argument('--threshold', type=float, default=0.1, help="relative slowdown considered a regression in --compare (default: %(default)s)")
+parser.add_argument('--filter', metavar='SUBSTRING', help="run only benchmarks containing given substring")
+parser.add_argument('--scale', type=float, default=1.0, help="scale the repeat counts (default: %(default)s)")
+args = parser.parse_args()
+
+path = os.path.dirname(__file__)
+results = {}
+
+def timethat(name: str, expr: str, *, setup: str = 'pass', repeats: int = 10000):
+    if args.filter and args.filter not in name: return
+
+    repeats = max(1, int(repeats*args.scale))
+    # Take the best of three runs to filter out noise from other processes
+    time = min(timeit.repeat(expr, number=repeats, repeat=3, globals=globals(), setup=setup))*1000000.0/repeats
+    results[name] = time
+    print('{:67} {:12.5f} µs'.format(name, time))
+
+def importer(plugin: str, filename: str):
+    try:
+        importer = trade.ImporterManager().load_and_instantiate(plugin)
+    except RuntimeError:
+        return None
+    importer.open_file(os.path.join(path, filename))
+    return importer
+
+points = np.random.default_rng(0).random((100000, 3), dtype='float32')
+points_out = np.empty_like(points)
+bytes_src = np.zeros(1024*1024, dtype='uint8')
+bytes_dst = np.empty_like(bytes_src)
+cube = primitives.cube_solid()
+sphere = meshtools.duplicate(primitives.uv_sphere_solid(32, 64))
+transformation = Matrix4.rotation_x(Deg(35.0))@Matrix4.translation((1.0, 2.0, 3.0))
+
+print("  strided array views from a buffer:\n")
+
+timethat('containers.StridedArrayView1D(1D np.array)', 'containers.StridedArrayView1D(a)', setup='a = bytes_src')
+timethat('containers.StridedArrayView2D(2D np.array)', 'containers.StridedArrayView2D(a)', setup='a = points')
+timethat('containers.MutableStridedArrayView2D(2D np.array)', 'containers.MutableStridedArrayView2D(a)', setup='a = points')
+timethat('np.asarray(containers.StridedArrayView2D)', 'np.asarray(a)', setup='a = containers.StridedArrayView2D(points)', repeats=1000)
+
+print("\n  mesh data access:\n")
+
+timethat('MeshData.attribute(POSITION)', 'cube.attribute(trade.MeshAttribute.POSITION)')
+timethat('MeshData.attribute(NORMAL)', 'cube.attribute(trade.MeshAttribute.NORMAL)')
+timethat('MeshData.indices', 'cube.indices')
+timethat('list(MeshData.attribute(POSITION))', 'list(cube.attribute(trade.MeshAttribute.POSITION))', repeats=1000)
+
+print("\n  meshtools:\n")
+
+timethat('meshtools.interleave(cube)', 'meshtools.interleave(cube)', repeats=1000)
+timethat('meshtools.interleave(sphere)', 'meshtools.interleave(sphere)', repeats=100)
+timethat('meshtools.remove_duplicates(sphere)', 'meshtools.remove_duplicates(sphere)', repeats=100)
+
+print("\n  batched math:\n")
+
+timethat('Matrix4.transform_point(), 1000 points in a loop', 'for i in range(1000): transformation.transform_point(Vector3(points[i]))', repeats=10)
+timethat('Matrix4.transform_points(), 100k points', 'transformation.transform_points(points, points_out)', repeats=100)
+timethat('math.dot(), 100k points', 'math.dot(points, points)', repeats=100)
+
+print("\n  utility.copy():\n")
+
+timethat('utility.copy(), 1 MB 1D', 'utility.copy(bytes_src, bytes_dst)', repeats=1000)
+timethat('utility.copy(), 100k Vector3 2D', 'utility.copy(points, points_out)', repeats=1000)
+timethat('np.copyto(), 100k Vector3 2D', 'np.copyto(points_out, points)', repeats=1000)
+
+gltf = importer('GltfImporter', 'scene.gltf')
+if gltf:
+    print("\n  scenetools:\n")
+
+    scene = gltf.scene(0)
+    timethat('scenetools.absolute_field_transformations3d()', 'scenetools.absolute_field_transformations3d(scene, trade.SceneField.TRANSFORMATION)', repeats=1000)
+    timethat('scenetools.parents_breadth_first()', 'scenetools.parents_breadth_first(scene)', repeats=1000)
+
+    print("\n  importer:\n")
+
+    # Unlike mesh.gltf, all meshes in this file import without errors
+    gltf.open_file(os.path.join(path, 'two-meshes.gltf'))
+    timethat('AbstractImporter.mesh() in a loop', 'for i in range(gltf.mesh_count): gltf.mesh(i)', repeats=1000)
+    timethat('AbstractImporter.open_file() + mesh()', 'gltf.open_file(filename); gltf.mesh(0)', setup=f'filename = {os.path.join(path, "two-meshes.gltf")!r}', repeats=1000)
+else:
+    print("\n  GltfImporter not available, skipping scenetools and importer benchmarks")
+
+if args.json:
+    with open(args.json, 'w') as f:
+        json.dump({
+            'python': platform.python_version(),
+            'platform': platform.platform(),
+            'numpy': np.__version__,
+            'unit': 'us',
+            'results': results
+        }, f, indent=2)
+
+if args.compare:
+    with open(args.compare) as f:
+        baseline = json.load(f)['results']
+
+    print("\n  comparison with {}:\n".format(args.compare))
+
+    regressions = 0
+    for name, time in results.items():
+        if name not in baseline: continue
+        ratio = time/baseline[name]
+        regression = ratio > 1.0 + args.threshold
+        if regression: regressions += 1
+        print('{:67} {:+11.1f} %{}'.format(name, (ratio - 1.0)*100.0, ' REGRESSION' if regression else ''))
+
+    if regressions:
+        print("\n  {} regressions over {:.0f} %".format(regressions, args.threshold*100.0))
+        sys.exit(1)
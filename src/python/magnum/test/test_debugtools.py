@@ -0,0 +1,186 @@
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021, 2022, 2023, 2024, 2025, 2026
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+import array
+import math
+import unittest
+
+from magnum import *
+from magnum import debugtools
+
+class FrameProfiler(unittest.TestCase):
+    def test_default(self):
+        profiler = debugtools.FrameProfiler()
+        self.assertEqual(profiler.measurement_count, 0)
+        self.assertEqual(profiler.measured_frame_count, 0)
+
+    def test_measurements(self):
+        counter = [0]
+        def begin():
+            counter[0] += 1
+        def end():
+            return counter[0]*10
+
+        queried = []
+        def begin_delayed(current):
+            pass
+        def end_delayed(current):
+            pass
+        def query(previous, current):
+            queried.append((previous, current))
+            return 1000
+
+        profiler = debugtools.FrameProfiler([
+            debugtools.FrameProfiler.Measurement("Counter", debugtools.FrameProfiler.Units.COUNT, begin=begin, end=end),
+            debugtools.FrameProfiler.Measurement("Delayed", debugtools.FrameProfiler.Units.NANOSECONDS, 2, begin_delayed, end_delayed, query)
+        ], max_frame_count=3)
+        self.assertTrue(profiler.is_enabled)
+        self.assertEqual(profiler.measurement_count, 2)
+        self.assertEqual(profiler.max_frame_count, 3)
+        self.assertEqual(profiler.measurement_name(0), "Counter")
+        self.assertEqual(profiler.measurement_units(0), debugtools.FrameProfiler.Units.COUNT)
+        self.assertEqual(profiler.measurement_delay(0), 1)
+        self.assertEqual(profiler.measurement_name(1), "Delayed")
+        self.assertEqual(profiler.measurement_delay(1), 2)
+
+        for i in range(3):
+            profiler.begin_frame()
+            profiler.end_frame()
+        self.assertEqual(profiler.measured_frame_count, 3)
+        self.assertTrue(profiler.is_measurement_available(0))
+        self.assertFalse(profiler.is_measurement_available(1))
+        self.assertEqual(profiler.measurement_mean(0), 20.0)
+        self.assertEqual(list(profiler.measurement_data(0)), [10.0, 20.0, 30.0])
+        self.assertIn("Counter", profiler.statistics())
+
+        with self.assertRaisesRegex(AssertionError, "measurement 1 not available yet"):
+            profiler.measurement_mean(1)
+        with self.assertRaisesRegex(AssertionError, "measurement 1 not available yet"):
+            profiler.measurement_data(1)
+
+        profiler.begin_frame()
+        profiler.end_frame()
+        self.assertTrue(profiler.is_measurement_available(1))
+        self.assertEqual(profiler.measurement_mean(1), 1000.0)
+        self.assertGreater(len(queried), 0)
+
+    def test_measurements_kept_alive(self):
+        def end():
+            return 5
+
+        profiler = debugtools.FrameProfiler()
+        # The measurement list gets deleted right after, the profiler should
+        # keep the measurements alive
+        profiler.setup([debugtools.FrameProfiler.Measurement("Five", debugtools.FrameProfiler.Units.BYTES, begin=lambda: None, end=end)], max_frame_count=1)
+        profiler.begin_frame()
+        profiler.end_frame()
+        self.assertEqual(profiler.measurement_mean(0), 5.0)
+
+    def test_callback_error(self):
+        def end():
+            raise ValueError("oh no")
+
+        profiler = debugtools.FrameProfiler([
+            debugtools.FrameProfiler.Measurement("Failing", debugtools.FrameProfiler.Units.COUNT, begin=lambda: None, end=end)
+        ], max_frame_count=1)
+        profiler.begin_frame()
+        with self.assertRaisesRegex(ValueError, "oh no"):
+            profiler.end_frame()
+
+    def test_invalid(self):
+        with self.assertRaisesRegex(AssertionError, "max frame count can't be zero"):
+            debugtools.FrameProfiler([], max_frame_count=0)
+        with self.assertRaisesRegex(AssertionError, "delay can't be zero"):
+            debugtools.FrameProfiler.Measurement("Delayed", debugtools.FrameProfiler.Units.COUNT, 0, lambda current: None, lambda current: None, lambda previous, current: 0)
+
+        profiler = debugtools.FrameProfiler()
+        with self.assertRaisesRegex(IndexError, "index 0 out of range for 0 measurements"):
+            profiler.measurement_name(0)
+        with self.assertRaisesRegex(IndexError, "index 0 out of range for 0 measurements"):
+            profiler.measurement_mean(0)
+        with self.assertRaisesRegex(IndexError, "index 0 out of range for 0 measurements"):
+            profiler.measurement_data(0)
+
+class ImageDelta(unittest.TestCase):
+    def test(self):
+        # 2x2 RGB pixels, padded for alignment
+        actual = ImageView2D(PixelFormat.RGB8_UNORM, (2, 2),
+            b'\x00\x00\x00\x0a\x0a\x0a  '
+            b'\xff\x00\x00\x00\x00\x00  ')
+        expected = ImageView2D(PixelFormat.RGB8_UNORM, (2, 2),
+            b'\x00\x00\x00\x0a\x0a\x0d  '
+            b'\x00\x00\x00\x00\x00\x00  ')
+
+        delta, max, mean = debugtools.image_delta(actual, expected)
+        self.assertEqual(delta.size, (2, 2))
+        self.assertEqual(delta.format, 'f')
+        # Raw channel values are compared, a pixel delta is a mean of the
+        # channel deltas
+        self.assertEqual(delta[0, 0], 0.0)
+        self.assertEqual(delta[0, 1], 1.0)
+        self.assertEqual(delta[1, 0], 85.0)
+        self.assertEqual(delta[1, 1], 0.0)
+        self.assertEqual(max, 85.0)
+        self.assertEqual(mean, 21.5)
+
+    def test_float(self):
+        actual = ImageView2D(PixelFormat.R32F, (4, 1),
+            array.array('f', [1.0, float('nan'), float('inf'), float('nan')]))
+        expected = ImageView2D(PixelFormat.R32F, (4, 1),
+            array.array('f', [0.5, float('nan'), float('inf'), 1.0]))
+
+        delta, max, mean = debugtools.image_delta(actual, expected)
+        # NaNs and infinities on both sides are treated as equal, a NaN on
+        # one side only makes the max NaN as well
+        self.assertEqual(delta[0, 0], 0.5)
+        self.assertEqual(delta[0, 1], 0.0)
+        self.assertEqual(delta[0, 2], 0.0)
+        self.assertTrue(math.isnan(delta[0, 3]))
+        self.assertTrue(math.isnan(max))
+
+    def test_half(self):
+        # 1.0 and 3.0 as half-floats
+        actual = ImageView2D(PixelFormat.R16F, (2, 1), b'\x00\x3c\x00\x42')
+        expected = ImageView2D(PixelFormat.R16F, (2, 1), b'\x00\x3c\x00\x3c')
+
+        delta, max, mean = debugtools.image_delta(actual, expected)
+        self.assertEqual(delta[0, 0], 0.0)
+        self.assertEqual(delta[0, 1], 2.0)
+        self.assertEqual(max, 2.0)
+        self.assertEqual(mean, 1.0)
+
+    def test_invalid(self):
+        a = ImageView2D(PixelFormat.R8_UNORM, (4, 1), b'abcd')
+        b = ImageView2D(PixelFormat.R8UI, (4, 1), b'abcd')
+        c = ImageView2D(PixelFormat.R8_UNORM, (2, 2), b'ab  cd  ')
+        d = ImageView2D(PixelFormat.DEPTH32F, (1, 1), b'abcd')
+
+        with self.assertRaisesRegex(AssertionError, "expected PixelFormat.R8_UNORM but got PixelFormat.R8UI"):
+            debugtools.image_delta(b, a)
+        with self.assertRaisesRegex(AssertionError, r"expected size Vector\(4, 1\) but got Vector\(2, 2\)"):
+            debugtools.image_delta(c, a)
+        with self.assertRaisesRegex(NotImplementedError, "delta calculation for this pixel format is not implemented yet, sorry"):
+            debugtools.image_delta(d, d)
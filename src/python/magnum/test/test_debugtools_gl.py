@@ -0,0 +1,63 @@
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021, 2022, 2023, 2024, 2025, 2026
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+import unittest
+
+# setUpModule gets called before everything else, skipping if GL tests can't
+# be run
+from . import GLTestCase, setUpModule
+
+from magnum import *
+from magnum import debugtools, gl
+import magnum
+
+class FrameProfilerGL(GLTestCase):
+    def test(self):
+        profiler = debugtools.FrameProfilerGL(debugtools.FrameProfilerGL.Values.FRAME_TIME|debugtools.FrameProfilerGL.Values.CPU_DURATION, max_frame_count=4)
+        self.assertEqual(profiler.values, debugtools.FrameProfilerGL.Values.FRAME_TIME|debugtools.FrameProfilerGL.Values.CPU_DURATION)
+        self.assertEqual(profiler.measurement_count, 2)
+        self.assertFalse(profiler.is_measurement_available(debugtools.FrameProfilerGL.Values.CPU_DURATION))
+
+        for i in range(5):
+            profiler.begin_frame()
+            gl.default_framebuffer.clear(gl.FramebufferClear.COLOR)
+            profiler.end_frame()
+
+        self.assertTrue(profiler.is_measurement_available(debugtools.FrameProfilerGL.Values.CPU_DURATION))
+        self.assertTrue(profiler.is_measurement_available(debugtools.FrameProfilerGL.Values.FRAME_TIME))
+        self.assertGreater(profiler.cpu_duration_mean, 0.0)
+        self.assertEqual(len(profiler.measurement_data(1)), 4)
+
+    def test_gpu_duration_not_enabled(self):
+        if magnum.TARGET_GLES2 or magnum.TARGET_WEBGL:
+            self.skipTest("GPU_DURATION not available on WebGL and ES2")
+
+        profiler = debugtools.FrameProfilerGL(debugtools.FrameProfilerGL.Values.CPU_DURATION, max_frame_count=4)
+
+        with self.assertRaisesRegex(AssertionError, "GPU_DURATION not enabled"):
+            profiler.gpu_duration_mean
+        with self.assertRaisesRegex(AssertionError, "GPU_DURATION not enabled"):
+            profiler.is_measurement_available(debugtools.FrameProfilerGL.Values.GPU_DURATION)
@@ -26,14 +26,48 @@
 
 import unittest
 
+from corrade import containers
 from magnum import *
-from magnum import math
+from magnum import math, primitives, trade
 
 try:
     import numpy as np
 except ModuleNotFoundError:
     raise unittest.SkipTest("numpy not installed")
 
+class Functions(unittest.TestCase):
+    def test_dot_batch(self):
+        a = np.array([[1.0, 2.0, 3.0],
+                      [0.5, 0.0, -1.0]], dtype='float32')
+        b = np.array([[2.0, 1.0, 0.0],
+                      [4.0, 7.0, 2.0]], dtype='float32')
+        dot = math.dot(a, b)
+        self.assertEqual(dot.format, 'f')
+        self.assertEqual(list(dot), [4.0, 0.0])
+
+    def test_dot_batch_double(self):
+        a = np.array([[1.0, 2.0], [3.0, 4.0]])
+        dot = np.array(math.dot(a, a))
+        self.assertEqual(dot.dtype, np.float64)
+        np.testing.assert_array_equal(dot, [5.0, 25.0])
+
+    def test_dot_batch_single(self):
+        # Single vectors still go through the non-batched overload
+        self.assertEqual(math.dot(np.array([1.0, 2.0, 3.0], dtype='float32'),
+                                  Vector3(3.0, 2.0, 1.0)), 10.0)
+
+    def test_dot_batch_invalid(self):
+        a = np.zeros((3, 3), dtype='float32')
+
+        with self.assertRaisesRegex(AssertionError, "expected a to be a view of two-, three- or four-component float or double vectors, got i"):
+            math.dot(np.zeros((3, 3), dtype='int32'), a)
+        with self.assertRaisesRegex(AssertionError, "expected b to have 3 f items in the second dimension, got 3 d"):
+            math.dot(a, np.zeros((3, 3)))
+        with self.assertRaisesRegex(AssertionError, "expected b to have 3 items, got 2"):
+            math.dot(a, np.zeros((2, 3), dtype='float32'))
+        with self.assertRaisesRegex(AssertionError, "second dimension of b is not contiguous"):
+            math.dot(a, np.zeros((3, 6), dtype='float32')[:, ::2])
+
 class Vector(unittest.TestCase):
     def test_from_numpy(self):
         a = Vector3(np.array([1.0, 2.0, 3.0]))
@@ -319,6 +353,15 @@ class Matrix3_(unittest.TestCase):
              [4.0, 5.0, 6.0],
              [7.0, 8.0, 9.0]]))
 
+    def test_transform_points_batch(self):
+        a = Matrix3.translation((1.0, 2.0))@Matrix3.scaling((2.0, 3.0))
+        points = np.array([[1.0, 1.0],
+                           [0.0, -1.0]], dtype='float32')
+        np.testing.assert_array_equal(a.transform_points(points),
+            [[3.0, 5.0], [1.0, -1.0]])
+        np.testing.assert_array_equal(a.transform_vectors(points),
+            [[2.0, 3.0], [0.0, -3.0]])
+
 class Matrix4_(unittest.TestCase):
     def test_from_numpy(self):
         a = Matrix4(np.array(
@@ -343,3 +386,58 @@ class Matrix4_(unittest.TestCase):
              [5.0, 6.0, 7.0, 8.0],
              [9.0, 10.0, 11.0, 12.0],
              [13.0, 14.0, 15.0, 16.0]]))
+
+    def test_transform_points_batch(self):
+        a = Matrix4.translation((1.0, 2.0, 3.0))@Matrix4.scaling((2.0, 3.0, 4.0))
+        points = np.array([[1.0, 1.0, 1.0],
+                           [0.0, -1.0, 0.5]], dtype='float32')
+
+        transformed = a.transform_points(points)
+        self.assertIsInstance(transformed, containers.MutableStridedArrayView2D)
+        self.assertEqual(transformed.format, 'f')
+        self.assertEqual(transformed.size, (2, 3))
+        self.assertEqual(Vector3(transformed[0]), a.transform_point(Vector3(points[0])))
+        self.assertEqual(Vector3(transformed[1]), a.transform_point(Vector3(points[1])))
+
+        vectors = np.array(a.transform_vectors(points))
+        np.testing.assert_array_equal(vectors,
+            [[2.0, 3.0, 4.0], [0.0, -3.0, 2.0]])
+
+    def test_transform_points_batch_into(self):
+        a = Matrix4.translation((1.0, 2.0, 3.0))
+        points = np.array([[1.0, 1.0, 1.0],
+                           [0.0, -1.0, 0.5]])
+        out = np.zeros((2, 3))
+        self.assertIsNone(Matrix4d(a).transform_points(points, out))
+        np.testing.assert_array_equal(out,
+            [[2.0, 3.0, 4.0], [1.0, 1.0, 3.5]])
+
+        # In-place
+        Matrix4d(a).transform_points(points, points)
+        np.testing.assert_array_equal(points, out)
+
+    def test_transform_points_batch_1d(self):
+        mesh = primitives.line3d((0.0, 1.0, 2.0), (3.0, 4.0, 5.0))
+        positions = mesh.attribute(trade.MeshAttribute.POSITION)
+        self.assertEqual(positions.format, '3f')
+
+        out = np.zeros((2, 3), dtype='float32')
+        Matrix4.translation((1.0, 1.0, 1.0)).transform_points(positions, out)
+        np.testing.assert_array_equal(out, [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+
+    def test_transform_points_batch_invalid(self):
+        a = Matrix4()
+        with self.assertRaisesRegex(AssertionError, "expected src to have 3 f items in the second dimension, got 2 f"):
+            a.transform_points(np.zeros((3, 2), dtype='float32'))
+        with self.assertRaisesRegex(AssertionError, "expected dst to have 3 items, got 2"):
+            a.transform_points(np.zeros((3, 3), dtype='float32'), np.zeros((2, 3), dtype='float32'))
+
+class Quaternion_(unittest.TestCase):
+    def test_transform_vectors_batch(self):
+        a = Quaternion.rotation(Deg(90.0), Vector3.z_axis())
+        vectors = np.array([[1.0, 0.0, 0.0],
+                            [0.0, 2.0, 3.0]], dtype='float32')
+        transformed = a.transform_vectors(vectors)
+        self.assertEqual(transformed.size, (2, 3))
+        for i in range(2):
+            self.assertEqual(Vector3(transformed[i]), a.transform_vector(Vector3(vectors[i])))
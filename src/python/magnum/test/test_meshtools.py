@@ -33,6 +33,86 @@ from corrade import containers
 from magnum import *
 from magnum import meshtools, primitives, trade
 
+class AverageCacheMissRatio(unittest.TestCase):
+    def test(self):
+        indices = array.array('H', [0, 1, 2, 0, 2, 3])
+        vertices = array.array('f', [0.0]*8)
+        mesh = trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, vertices, [
+            trade.MeshAttributeData(trade.MeshAttribute.POSITION, VertexFormat.VECTOR2, containers.StridedArrayView1D(vertices).expanded(0, (4, 2)))
+        ])
+
+        # Each vertex is a miss just once, four misses for two triangles
+        self.assertEqual(meshtools.average_cache_miss_ratio(mesh), 2.0)
+        # With a cache size of one, only consecutive reuse is a hit
+        self.assertEqual(meshtools.average_cache_miss_ratio(mesh, cache_size=1), 3.0)
+
+    def test_invalid(self):
+        with self.assertRaisesRegex(AssertionError, "the mesh is not indexed"):
+            meshtools.average_cache_miss_ratio(primitives.line3d())
+        with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.TRIANGLES but got MeshPrimitive.LINES"):
+            meshtools.average_cache_miss_ratio(primitives.cube_wireframe())
+        with self.assertRaisesRegex(AssertionError, "expected a non-zero cache size"):
+            meshtools.average_cache_miss_ratio(primitives.cube_solid(), cache_size=0)
+
+        indices = array.array('H', [0, 1, 2, 2])
+        with self.assertRaisesRegex(AssertionError, "expected index count to be divisible by 3, got 4"):
+            meshtools.average_cache_miss_ratio(trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, b'', [], vertex_count=3))
+
+        indices = array.array('H', [0, 1, 3])
+        with self.assertRaisesRegex(AssertionError, "index 3 out of range for 3 vertices"):
+            meshtools.average_cache_miss_ratio(trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, b'', [], vertex_count=3))
+
+class BoundingVolume(unittest.TestCase):
+    def test_range(self):
+        self.assertEqual(meshtools.bounding_range(primitives.cube_solid()), Range3D((-1.0, -1.0, -1.0), (1.0, 1.0, 1.0)))
+
+        transformed = meshtools.transform3d(primitives.cube_solid(), Matrix4.translation((1.0, 2.0, 3.0))@Matrix4.scaling((0.5, 2.0, 1.0)))
+        self.assertEqual(meshtools.bounding_range(transformed), Range3D((0.5, 0.0, 2.0), (1.5, 4.0, 4.0)))
+
+        # 2D positions have Z zero
+        self.assertEqual(meshtools.bounding_range(primitives.square_solid()), Range3D((-1.0, -1.0, 0.0), (1.0, 1.0, 0.0)))
+
+    def test_sphere(self):
+        mesh = primitives.cube_solid()
+        center, radius = meshtools.bounding_sphere(mesh)
+
+        # The algorithm is approximate, so check just that it's not too large
+        # and contains all points
+        self.assertGreaterEqual(radius, Vector3(1.0).length())
+        self.assertLess(radius, Vector3(1.0).length()*1.1)
+        for position in mesh.attribute(trade.MeshAttribute.POSITION):
+            self.assertLessEqual((Vector3(position) - center).length(), radius*1.0001)
+
+    def test_range_batch(self):
+        cube = primitives.cube_solid()
+        transformed = meshtools.transform3d(cube, Matrix4.translation((1.0, 2.0, 3.0)))
+
+        ranges = meshtools.bounding_range_batch([cube, transformed, cube], thread_count=2)
+        self.assertEqual(ranges.size, (3, 2, 3))
+        self.assertEqual(ranges.format, 'f')
+        self.assertEqual(list(ranges[0][0]), [-1.0, -1.0, -1.0])
+        self.assertEqual(list(ranges[0][1]), [1.0, 1.0, 1.0])
+        self.assertEqual(list(ranges[1][0]), [0.0, 1.0, 2.0])
+        self.assertEqual(list(ranges[1][1]), [2.0, 3.0, 4.0])
+        self.assertEqual(list(ranges[2][1]), [1.0, 1.0, 1.0])
+
+        # Empty list is fine
+        self.assertEqual(meshtools.bounding_range_batch([]).size, (0, 2, 3))
+
+    def test_invalid(self):
+        no_positions = meshtools.filter_only_attributes(primitives.cube_solid(), [trade.MeshAttribute.NORMAL])
+
+        with self.assertRaisesRegex(KeyError, "the mesh has no positions with index 0"):
+            meshtools.bounding_range(no_positions)
+        with self.assertRaisesRegex(KeyError, "the mesh has no positions with index 1"):
+            meshtools.bounding_sphere(primitives.cube_solid(), id=1)
+        with self.assertRaisesRegex(KeyError, "the mesh has no positions with index 0 in morph target 37"):
+            meshtools.bounding_range(primitives.cube_solid(), morph_target_id=37)
+        with self.assertRaisesRegex(KeyError, "mesh 1 has no positions with index 0"):
+            meshtools.bounding_range_batch([primitives.cube_solid(), no_positions])
+        with self.assertRaisesRegex(KeyError, "mesh 0 has no positions with index 0 in morph target 37"):
+            meshtools.bounding_range_batch([primitives.cube_solid()], morph_target_id=37)
+
 class CompressIndices(unittest.TestCase):
     def test(self):
         mesh = primitives.cube_solid()
@@ -49,6 +129,21 @@ class CompressIndices(unittest.TestCase):
         with self.assertRaisesRegex(AssertionError, "the mesh is not indexed"):
             meshtools.compress_indices(mesh)
 
+    def test_batch(self):
+        meshes = [primitives.cube_solid(), primitives.icosphere_solid(subdivisions=2)]
+
+        compressed = meshtools.compress_indices_batch(meshes, at_least=MeshIndexType.UNSIGNED_BYTE, thread_count=2)
+        self.assertEqual(len(compressed), 2)
+        # Results are in the same order as the input
+        self.assertEqual(compressed[0].index_type, MeshIndexType.UNSIGNED_BYTE)
+        self.assertEqual(compressed[0].index_count, meshes[0].index_count)
+        self.assertEqual(compressed[1].index_type, MeshIndexType.UNSIGNED_BYTE)
+        self.assertEqual(compressed[1].index_count, meshes[1].index_count)
+
+    def test_batch_not_indexed(self):
+        with self.assertRaisesRegex(AssertionError, "mesh 1 is not indexed"):
+            meshtools.compress_indices_batch([primitives.cube_solid(), primitives.line2d()])
+
 class Concatenate(unittest.TestCase):
     def test(self):
         cube = primitives.cube_solid()
@@ -75,6 +170,151 @@ class Concatenate(unittest.TestCase):
         with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.LINES but got MeshPrimitive.TRIANGLES in mesh 1"):
             meshtools.concatenate([primitives.line3d(), primitives.cube_solid()])
 
+class MeshConcatenator(unittest.TestCase):
+    def test(self):
+        cube = primitives.cube_solid()
+        plane = meshtools.generate_indices(primitives.plane_solid())
+        cube_refcount = sys.getrefcount(cube)
+
+        concatenator = meshtools.MeshConcatenator()
+        self.assertEqual(len(concatenator), 0)
+
+        concatenator.append(cube)
+        concatenator.append(plane)
+        concatenator.append(cube)
+        self.assertEqual(len(concatenator), 3)
+        # The appended meshes are referenced by the concatenator
+        self.assertEqual(sys.getrefcount(cube), cube_refcount + 2)
+
+        concatenated = concatenator.finalize()
+        self.assertEqual(concatenated.vertex_count, 2*cube.vertex_count + plane.vertex_count)
+        self.assertEqual(concatenated.index_count, 2*cube.index_count + plane.index_count)
+
+        # The concatenator is emptied after, not referencing anything anymore
+        self.assertEqual(len(concatenator), 0)
+        self.assertEqual(sys.getrefcount(cube), cube_refcount)
+
+    def test_reuse(self):
+        cube = primitives.cube_solid()
+        plane = meshtools.generate_indices(primitives.plane_solid())
+
+        concatenator = meshtools.MeshConcatenator()
+        concatenator.append(plane)
+        concatenator.append(cube)
+        first = concatenator.finalize()
+        first_id = id(first)
+        self.assertEqual(first.vertex_count, cube.vertex_count + plane.vertex_count)
+        self.assertEqual(first.index_count, cube.index_count + plane.index_count)
+
+        # The first result is still referenced, so it's not reused
+        concatenator.append(cube)
+        second = concatenator.finalize()
+        self.assertIsNot(second, first)
+        self.assertEqual(first.vertex_count, cube.vertex_count + plane.vertex_count)
+        self.assertEqual(second.vertex_count, cube.vertex_count)
+
+        # A view on its data keeps it from being reused as well
+        positions = first.attribute(trade.MeshAttribute.POSITION)
+        plane_position = plane.attribute(trade.MeshAttribute.POSITION)[1]
+        del first
+        concatenator.append(cube)
+        third = concatenator.finalize()
+        self.assertNotEqual(id(third), first_id)
+        self.assertEqual(positions[1], plane_position)
+
+        # Once nothing references it, its storage is reused for the next
+        # result
+        del positions
+        del third
+        concatenator.append(plane)
+        fourth = concatenator.finalize()
+        self.assertEqual(id(fourth), first_id)
+        self.assertEqual(fourth.vertex_count, plane.vertex_count)
+        self.assertEqual(fourth.index_count, plane.index_count)
+        self.assertEqual(fourth.attribute(trade.MeshAttribute.POSITION)[1], plane_position)
+        self.assertEqual(fourth.vertex_data_flags, trade.DataFlags.OWNED|trade.DataFlags.MUTABLE)
+        self.assertIsNone(fourth.owner)
+
+    def test_reuse_stored_on_attribute(self):
+        cube = primitives.cube_solid()
+        plane = meshtools.generate_indices(primitives.plane_solid())
+
+        # Like a builder that keeps both the concatenator and the last result
+        # around between frames
+        class Terrain:
+            def __init__(self):
+                self.concatenator = meshtools.MeshConcatenator()
+                self.mesh = None
+
+            def build(self, tiles):
+                for tile in tiles:
+                    self.concatenator.append(tile)
+                self.mesh = self.concatenator.finalize()
+
+        terrain = Terrain()
+        terrain.build([cube, plane])
+        first = terrain.mesh
+        first_id = id(first)
+        self.assertEqual(first.vertex_count, cube.vertex_count + plane.vertex_count)
+
+        # The result stored on the attribute isn't touched by the next build
+        terrain.build([plane])
+        self.assertEqual(first.vertex_count, cube.vertex_count + plane.vertex_count)
+        self.assertEqual(first.index_count, cube.index_count + plane.index_count)
+        self.assertEqual(terrain.mesh.vertex_count, plane.vertex_count)
+
+        # Once replaced on the attribute and not referenced from anywhere else,
+        # it gets reused, alternating with the other result
+        del first
+        terrain.build([cube])
+        self.assertEqual(id(terrain.mesh), first_id)
+        self.assertEqual(terrain.mesh.vertex_count, cube.vertex_count)
+        self.assertEqual(terrain.mesh.index_count, cube.index_count)
+
+    def test_appended_result_not_reused(self):
+        cube = primitives.cube_solid()
+
+        concatenator = meshtools.MeshConcatenator()
+        concatenator.append(cube)
+        concatenated = concatenator.finalize()
+        concatenated_id = id(concatenated)
+
+        # A previous result that's appended isn't concatenated into even if
+        # it's not referenced from anywhere else
+        concatenator.append(concatenated)
+        del concatenated
+        concatenator.append(cube)
+        concatenated = concatenator.finalize()
+        self.assertNotEqual(id(concatenated), concatenated_id)
+        self.assertEqual(concatenated.vertex_count, 2*cube.vertex_count)
+
+    def test_clear(self):
+        cube = primitives.cube_solid()
+        cube_refcount = sys.getrefcount(cube)
+
+        concatenator = meshtools.MeshConcatenator()
+        concatenator.append(cube)
+        self.assertEqual(sys.getrefcount(cube), cube_refcount + 1)
+
+        concatenator.clear()
+        self.assertEqual(len(concatenator), 0)
+        self.assertEqual(sys.getrefcount(cube), cube_refcount)
+
+    def test_invalid(self):
+        concatenator = meshtools.MeshConcatenator()
+
+        with self.assertRaisesRegex(AssertionError, "no meshes appended"):
+            concatenator.finalize()
+        with self.assertRaisesRegex(AssertionError, "MeshPrimitive.TRIANGLE_STRIP is not supported, turn it into a plain indexed mesh first"):
+            concatenator.append(primitives.plane_solid())
+
+        concatenator.append(primitives.cube_solid())
+        with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.TRIANGLES but got MeshPrimitive.LINES in mesh 1"):
+            concatenator.append(primitives.line3d())
+
+        # Failed appends aren't recorded
+        self.assertEqual(len(concatenator), 1)
+
 class Duplicate(unittest.TestCase):
     def test(self):
         mesh = primitives.cube_solid()
@@ -107,6 +347,121 @@ class GenerateIndices(unittest.TestCase):
         with self.assertRaisesRegex(AssertionError, "invalid primitive MeshPrimitive.TRIANGLES"):
             meshtools.generate_indices(mesh)
 
+    def test_batch(self):
+        indexed = meshtools.generate_indices_batch([primitives.cube_solid_strip(), primitives.plane_solid()])
+        self.assertEqual(len(indexed), 2)
+        self.assertEqual(indexed[0].primitive, MeshPrimitive.TRIANGLES)
+        self.assertEqual(indexed[0].index_count, 36)
+        self.assertEqual(indexed[1].primitive, MeshPrimitive.TRIANGLES)
+        self.assertEqual(indexed[1].index_count, 6)
+
+    def test_batch_invalid_primitive(self):
+        with self.assertRaisesRegex(AssertionError, "invalid primitive MeshPrimitive.TRIANGLES in mesh 1"):
+            meshtools.generate_indices_batch([primitives.plane_solid(), primitives.cube_solid()])
+
+class GenerateNormals(unittest.TestCase):
+    def test_flat(self):
+        mesh = primitives.cube_solid()
+        self.assertTrue(mesh.is_indexed)
+        without_normals = meshtools.filter_except_attributes(mesh, [trade.MeshAttribute.NORMAL])
+        self.assertFalse(without_normals.has_attribute(trade.MeshAttribute.NORMAL))
+
+        flat = meshtools.generate_flat_normals(without_normals)
+        self.assertFalse(flat.is_indexed)
+        self.assertEqual(flat.vertex_count, 36)
+        self.assertEqual(flat.attribute_count(), 2)
+
+        # Each cube face is planar, so the flat normals are the same as the
+        # original ones, just duplicated
+        indices = mesh.indices
+        normals = mesh.attribute(trade.MeshAttribute.NORMAL)
+        flat_normals = flat.attribute(trade.MeshAttribute.NORMAL)
+        for i in range(36):
+            self.assertEqual(flat_normals[i], normals[indices[i]])
+
+    def test_flat_nonindexed(self):
+        mesh = meshtools.duplicate(primitives.cube_solid())
+        self.assertFalse(mesh.is_indexed)
+
+        # Existing normals get replaced, not duplicated
+        flat = meshtools.generate_flat_normals(mesh)
+        self.assertFalse(flat.is_indexed)
+        self.assertEqual(flat.vertex_count, 36)
+        self.assertEqual(flat.attribute_count(), 2)
+        self.assertEqual(flat.attribute(trade.MeshAttribute.NORMAL)[0], Vector3(0.0, 0.0, 1.0))
+
+    def test_smooth(self):
+        mesh = primitives.cube_solid()
+        without_normals = meshtools.filter_except_attributes(mesh, [trade.MeshAttribute.NORMAL])
+
+        smooth = meshtools.generate_smooth_normals(without_normals)
+        self.assertTrue(smooth.is_indexed)
+        self.assertEqual(smooth.vertex_count, 24)
+        self.assertEqual(smooth.attribute_count(), 2)
+
+        # Cube faces don't share vertices, so the normals are the same as the
+        # original ones
+        normals = mesh.attribute(trade.MeshAttribute.NORMAL)
+        smooth_normals = smooth.attribute(trade.MeshAttribute.NORMAL)
+        for i in range(24):
+            self.assertEqual(smooth_normals[i], normals[i])
+
+    def test_invalid(self):
+        with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.TRIANGLES but got MeshPrimitive.LINES"):
+            meshtools.generate_flat_normals(primitives.line3d())
+        with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.TRIANGLES but got MeshPrimitive.TRIANGLE_STRIP"):
+            meshtools.generate_flat_normals(primitives.plane_solid())
+        with self.assertRaisesRegex(AssertionError, "the mesh is not indexed"):
+            meshtools.generate_smooth_normals(meshtools.duplicate(primitives.cube_solid()))
+        with self.assertRaisesRegex(AssertionError, "expected 3D positions but got VertexFormat.VECTOR2"):
+            meshtools.generate_flat_normals(meshtools.generate_indices(primitives.circle2d_solid(3)))
+
+        indices = array.array('H', [0, 1, 3])
+        vertices = array.array('f', [0.0]*9)
+        mesh = trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, vertices, [
+            trade.MeshAttributeData(trade.MeshAttribute.POSITION, VertexFormat.VECTOR3, containers.StridedArrayView1D(vertices).expanded(0, (3, 3)))
+        ])
+        with self.assertRaisesRegex(AssertionError, "index 3 out of range for 3 vertices"):
+            meshtools.generate_flat_normals(mesh)
+        with self.assertRaisesRegex(AssertionError, "index 3 out of range for 3 vertices"):
+            meshtools.generate_smooth_normals(mesh)
+
+class GenerateTangents(unittest.TestCase):
+    def test(self):
+        # Magnum's own plane tangents are used as a reference
+        reference = primitives.plane_solid(primitives.PlaneFlags.TEXTURE_COORDINATES|primitives.PlaneFlags.TANGENTS)
+        mesh = meshtools.generate_indices(primitives.plane_solid(primitives.PlaneFlags.TEXTURE_COORDINATES))
+        self.assertFalse(mesh.has_attribute(trade.MeshAttribute.TANGENT))
+
+        with_tangents = meshtools.generate_tangents(mesh)
+        self.assertTrue(with_tangents.is_indexed)
+        self.assertEqual(with_tangents.vertex_count, 4)
+        self.assertEqual(with_tangents.attribute_format(trade.MeshAttribute.TANGENT), VertexFormat.VECTOR4)
+
+        reference_tangents = reference.attribute(trade.MeshAttribute.TANGENT)
+        tangents = with_tangents.attribute(trade.MeshAttribute.TANGENT)
+        for i in range(4):
+            self.assertEqual(tangents[i], reference_tangents[i])
+
+    def test_nonindexed(self):
+        mesh = meshtools.duplicate(meshtools.generate_indices(primitives.plane_solid(primitives.PlaneFlags.TEXTURE_COORDINATES|primitives.PlaneFlags.TANGENTS)))
+        self.assertFalse(mesh.is_indexed)
+
+        # Existing tangents get replaced, not duplicated
+        with_tangents = meshtools.generate_tangents(mesh)
+        self.assertEqual(with_tangents.attribute_count(), mesh.attribute_count())
+        tangents = with_tangents.attribute(trade.MeshAttribute.TANGENT)
+        for i in range(6):
+            self.assertEqual(tangents[i], Vector4(1.0, 0.0, 0.0, 1.0))
+
+    def test_invalid(self):
+        with self.assertRaisesRegex(AssertionError, "expected MeshPrimitive.TRIANGLES but got MeshPrimitive.TRIANGLE_STRIP"):
+            meshtools.generate_tangents(primitives.plane_solid(primitives.PlaneFlags.TEXTURE_COORDINATES))
+        with self.assertRaisesRegex(KeyError, "the mesh has no normals"):
+            meshtools.generate_tangents(meshtools.filter_except_attributes(primitives.cube_solid(), [trade.MeshAttribute.NORMAL]))
+        with self.assertRaisesRegex(KeyError, "the mesh has no texture coordinates"):
+            meshtools.generate_tangents(primitives.cube_solid())
+
 class Filter(unittest.TestCase):
     def test(self):
         mesh = primitives.cube_solid()
@@ -218,6 +573,14 @@ class Interleave(unittest.TestCase):
         # Gap after normals removed
         self.assertEqual(interleaved_packed.attribute_stride(trade.MeshAttribute.POSITION), 12 + 8)
 
+    def test_batch(self):
+        mesh = meshtools.filter_except_attributes(primitives.circle3d_solid(3, primitives.Circle3DFlags.TEXTURE_COORDINATES), [trade.MeshAttribute.NORMAL])
+
+        interleaved = meshtools.interleave_batch([mesh, primitives.plane_solid()], flags=meshtools.InterleaveFlags.NONE)
+        self.assertEqual(len(interleaved), 2)
+        self.assertEqual(interleaved[0].attribute_stride(trade.MeshAttribute.POSITION), 12 + 8)
+        self.assertEqual(interleaved[1].vertex_count, 4)
+
     def test_extra(self):
         interleaved = meshtools.interleave(primitives.plane_solid(), extra=[
             trade.MeshAttributeData(trade.MeshAttribute.OBJECT_ID, VertexFormat.UNSIGNED_SHORT, array.array('H', [3, 176, 2, 14]))
@@ -242,6 +605,40 @@ class Copy(unittest.TestCase):
         copy = meshtools.copy(mesh)
         self.assertEqual(copy.vertex_data_flags, trade.DataFlags.OWNED|trade.DataFlags.MUTABLE)
 
+class OptimizeVertexFetch(unittest.TestCase):
+    def test(self):
+        indices = array.array('H', [2, 3, 0, 0, 3, 1])
+        ids = array.array('H', [10, 11, 12, 13, 14])
+        mesh = trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, ids, [
+            trade.MeshAttributeData(trade.MeshAttribute.OBJECT_ID, VertexFormat.UNSIGNED_SHORT, ids)
+        ])
+
+        optimized = meshtools.optimize_vertex_fetch(mesh)
+        self.assertEqual(optimized.index_type, MeshIndexType.UNSIGNED_SHORT)
+        self.assertEqual(optimized.vertex_count, 5)
+        # Vertices are in order of first use, the unreferenced one is last
+        self.assertEqual(list(optimized.indices), [0, 1, 2, 2, 1, 3])
+        self.assertEqual(list(optimized.attribute(trade.MeshAttribute.OBJECT_ID)), [12, 13, 10, 11, 14])
+        # The original is left untouched
+        self.assertEqual(list(indices), [2, 3, 0, 0, 3, 1])
+        self.assertEqual(list(ids), [10, 11, 12, 13, 14])
+
+    def test_interleaved(self):
+        mesh = primitives.icosphere_solid(subdivisions=1)
+        optimized = meshtools.optimize_vertex_fetch(mesh)
+        self.assertEqual(optimized.vertex_count, mesh.vertex_count)
+        self.assertEqual(optimized.attribute_stride(trade.MeshAttribute.POSITION), mesh.attribute_stride(trade.MeshAttribute.POSITION))
+
+        # The triangles are still the same
+        positions = mesh.attribute(trade.MeshAttribute.POSITION)
+        optimized_positions = optimized.attribute(trade.MeshAttribute.POSITION)
+        for i in range(mesh.index_count):
+            self.assertEqual(optimized_positions[optimized.indices[i]], positions[mesh.indices[i]])
+
+    def test_not_indexed(self):
+        with self.assertRaisesRegex(AssertionError, "the mesh is not indexed"):
+            meshtools.optimize_vertex_fetch(primitives.line3d())
+
 class RemoveDuplicates(unittest.TestCase):
     def test(self):
         mesh = meshtools.duplicate(primitives.cube_solid())
@@ -252,6 +649,22 @@ class RemoveDuplicates(unittest.TestCase):
         self.assertTrue(deduplicated.is_indexed)
         self.assertEqual(deduplicated.vertex_count, 24)
 
+    def test_batch(self):
+        meshes = [meshtools.duplicate(primitives.cube_solid()) for i in range(5)] + [meshtools.duplicate(primitives.icosphere_solid(subdivisions=1))]
+
+        # More threads than meshes
+        for thread_count in [0, 1, 3, 16]:
+            with self.subTest(thread_count=thread_count):
+                deduplicated = meshtools.remove_duplicates_batch(meshes, thread_count=thread_count)
+                self.assertEqual(len(deduplicated), 6)
+                for i in range(5):
+                    self.assertTrue(deduplicated[i].is_indexed)
+                    self.assertEqual(deduplicated[i].vertex_count, 24)
+                self.assertEqual(deduplicated[5].vertex_count, meshtools.remove_duplicates(meshes[5]).vertex_count)
+
+    def test_batch_empty(self):
+        self.assertEqual(meshtools.remove_duplicates_batch([]), [])
+
     def test_fuzzy(self):
         mesh = meshtools.duplicate(primitives.cube_solid())
         self.assertFalse(mesh.is_indexed)
@@ -265,6 +678,35 @@ class RemoveDuplicates(unittest.TestCase):
         single_point = meshtools.remove_duplicates_fuzzy(mesh, float_epsilon=1e6)
         self.assertEqual(single_point.vertex_count, 1)
 
+class Tipsify(unittest.TestCase):
+    def test(self):
+        mesh = meshtools.copy(primitives.icosphere_solid(subdivisions=3))
+        triangles = sorted(tuple(mesh.indices[i:i + 3]) for i in range(0, mesh.index_count, 3))
+        acmr_before = meshtools.average_cache_miss_ratio(mesh)
+
+        meshtools.tipsify_in_place(mesh)
+        self.assertLessEqual(meshtools.average_cache_miss_ratio(mesh), acmr_before)
+
+        # Just the order of triangles changes
+        self.assertEqual(sorted(tuple(mesh.indices[i:i + 3]) for i in range(0, mesh.index_count, 3)), triangles)
+
+    def test_not_mutable(self):
+        mesh = primitives.cube_solid()
+        self.assertEqual(mesh.index_data_flags, trade.DataFlags.GLOBAL)
+
+        with self.assertRaisesRegex(AssertionError, "index data not mutable"):
+            meshtools.tipsify_in_place(mesh)
+
+    def test_invalid(self):
+        with self.assertRaisesRegex(AssertionError, "the mesh is not indexed"):
+            meshtools.tipsify_in_place(primitives.line3d())
+        with self.assertRaisesRegex(AssertionError, "expected a non-zero cache size"):
+            meshtools.tipsify_in_place(meshtools.copy(primitives.cube_solid()), cache_size=0)
+
+        indices = array.array('H', [0, 1, 3])
+        with self.assertRaisesRegex(AssertionError, "index 3 out of range for 3 vertices"):
+            meshtools.tipsify_in_place(trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, b'', [], vertex_count=3))
+
 class Transform(unittest.TestCase):
     # TODO test everything with explicit morph target once there's support in
     #   some importer
@@ -290,6 +732,18 @@ class Transform(unittest.TestCase):
         transformed = meshtools.transform3d(mesh, Matrix4.translation(Vector3.x_axis(100.0)))
         self.assertEqual(transformed.attribute(trade.MeshAttribute.POSITION)[0], (100.0, 0.0, 0.0))
 
+    def test_3d_batch(self):
+        transformed = meshtools.transform3d_batch([primitives.line3d(), primitives.cube_solid()], Matrix4.translation(Vector3.x_axis(100.0)))
+        self.assertEqual(len(transformed), 2)
+        self.assertEqual(transformed[0].attribute(trade.MeshAttribute.POSITION)[0], (100.0, 0.0, 0.0))
+        self.assertEqual(transformed[1].attribute(trade.MeshAttribute.POSITION)[0], (99.0, -1.0, 1.0))
+
+    def test_3d_batch_invalid(self):
+        with self.assertRaisesRegex(KeyError, "mesh 1 has no positions with index 1"):
+            meshtools.transform3d_batch([primitives.line3d(), primitives.line3d()], Matrix4(), id=1)
+        with self.assertRaisesRegex(AssertionError, "expected 3D positions but got VertexFormat.VECTOR2 in mesh 1"):
+            meshtools.transform3d_batch([primitives.line3d(), primitives.line2d()], Matrix4())
+
     def test_3d_in_place(self):
         mesh = primitives.line3d()
         self.assertEqual(mesh.attribute(trade.MeshAttribute.POSITION)[0], (0.0, 0.0, 0.0))
@@ -248,6 +248,57 @@ class Filter(unittest.TestCase):
         # The original scene isn't referenced by these, it's a full copy
         self.assertEqual(sys.getrefcount(scene), scene_refcount)
 
+    def test_field_entries_bits_strings(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
+
+        scene = importer.scene(0)
+        scene_refcount = sys.getrefcount(scene)
+        scene_field_yes = importer.scene_field_for_name('yes')
+        scene_field_string = importer.scene_field_for_name('aString')
+        self.assertEqual(scene.field_count, 8)
+        self.assertEqual(list(scene.mapping(scene_field_yes)), [2, 3])
+        self.assertEqual(list(scene.field(scene_field_yes)), [True, False])
+        self.assertEqual(list(scene.mapping(scene_field_string)), [2])
+
+        yeses_to_keep = containers.BitArray.value_init(2)
+        yeses_to_keep[1] = True
+        cameras_to_keep = containers.BitArray.direct_init(2, True)
+        cameras_to_keep[0] = False
+
+        filtered1 = scenetools.filter_field_entries(scene, [
+            (scene_field_yes, yeses_to_keep),
+            (trade.SceneField.CAMERA, cameras_to_keep),
+            (scene_field_string, containers.BitArray.value_init(1))
+        ])
+        filtered2 = scenetools.filter_field_entries(scene, [
+            (scene.field_id(scene_field_yes), yeses_to_keep),
+            (scene.field_id(trade.SceneField.CAMERA), cameras_to_keep),
+            (scene.field_id(scene_field_string), containers.BitArray.value_init(1))
+        ])
+        for filtered in [filtered1, filtered2]:
+            self.assertEqual(filtered.field_count, 8)
+            self.assertEqual(list(filtered.mapping(scene_field_yes)), [3])
+            self.assertEqual(list(filtered.field(scene_field_yes)), [False])
+            self.assertEqual(list(filtered.mapping(trade.SceneField.CAMERA)), [3])
+            self.assertEqual(list(filtered.field(trade.SceneField.CAMERA)), [0])
+            self.assertEqual(filtered.field_size(scene_field_string), 0)
+            # Fields that weren't listed are copied in full
+            self.assertEqual(list(filtered.mapping(trade.SceneField.TRANSLATION)), list(scene.mapping(trade.SceneField.TRANSLATION)))
+            self.assertEqual(list(filtered.field(trade.SceneField.TRANSLATION)), list(scene.field(trade.SceneField.TRANSLATION)))
+
+        # Keeping the string results in the same contents
+        filtered = scenetools.filter_field_entries(scene, [
+            (scene_field_string, containers.BitArray.direct_init(1, True))
+        ])
+        self.assertEqual(list(filtered.mapping(scene_field_string)), [2])
+        self.assertEqual(filtered.fields_as_dict()[scene_field_string][1], ['hello!'])
+        self.assertEqual(list(filtered.field(scene_field_yes)), [True, False])
+
+        # The original scene isn't referenced by these, it's a full copy
+        del filtered, filtered1, filtered2
+        self.assertEqual(sys.getrefcount(scene), scene_refcount)
+
     def test_field_entries_invalid(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
@@ -289,23 +340,6 @@ class Filter(unittest.TestCase):
                 (trade.SceneField.TRANSLATION, containers.BitArray.value_init(4))
             ])
 
-        with self.assertRaisesRegex(NotImplementedError, "filtering string fields is not implemented yet, sorry"):
-            scenetools.filter_field_entries(scene, [
-                (scene.field_id(importer.scene_field_for_name('aString')), containers.BitArray.value_init(1))
-            ])
-        with self.assertRaisesRegex(NotImplementedError, "filtering string fields is not implemented yet, sorry"):
-            scenetools.filter_field_entries(scene, [
-                (importer.scene_field_for_name('aString'), containers.BitArray.value_init(1))
-            ])
-        with self.assertRaisesRegex(NotImplementedError, "filtering bit fields is not implemented yet, sorry"):
-            scenetools.filter_field_entries(scene, [
-                (scene.field_id(importer.scene_field_for_name('yes')), containers.BitArray.value_init(2))
-            ])
-        with self.assertRaisesRegex(NotImplementedError, "filtering bit fields is not implemented yet, sorry"):
-            scenetools.filter_field_entries(scene, [
-                (importer.scene_field_for_name('yes'), containers.BitArray.value_init(2))
-            ])
-
     def test_objects(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
@@ -334,6 +368,106 @@ class Filter(unittest.TestCase):
         # The original scene isn't referenced by this one, it's a full copy
         self.assertEqual(sys.getrefcount(scene), scene_refcount)
 
+    def test_objects_bits_strings(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
+
+        scene = importer.scene(0)
+        scene_refcount = sys.getrefcount(scene)
+        scene_field_yes = importer.scene_field_for_name('yes')
+        scene_field_string = importer.scene_field_for_name('aString')
+        self.assertEqual(scene.mapping_bound, 4)
+
+        # Object 2 has both a bit and a string field
+        objects_to_keep = containers.BitArray.direct_init(scene.mapping_bound, True)
+        objects_to_keep[2] = False
+
+        filtered = scenetools.filter_objects(scene, objects_to_keep)
+        self.assertEqual(filtered.mapping_bound, 4)
+        self.assertEqual(filtered.field_count, 8)
+        self.assertEqual(list(filtered.mapping(scene_field_yes)), [3])
+        self.assertEqual(list(filtered.field(scene_field_yes)), [False])
+        self.assertEqual(filtered.field_size(scene_field_string), 0)
+        self.assertEqual(filtered.field_size(trade.SceneField.PARENT), 3)
+        self.assertEqual(list(filtered.mapping(trade.SceneField.CAMERA)), [3])
+        self.assertEqual(list(filtered.field(trade.SceneField.CAMERA)), [0])
+        # The original scene isn't referenced by this one, it's a full copy
+        del filtered
+        self.assertEqual(sys.getrefcount(scene), scene_refcount)
+
+    def test_bits_strings_shared_mapping(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "scene-trs-mesh.gltf"))
+
+        scene = importer.scene(0)
+        scene_field_yes = importer.scene_field_for_name('yes')
+        scene_field_string = importer.scene_field_for_name('aString')
+        self.assertEqual(scene.mapping_bound, 4)
+        self.assertEqual(list(scene.mapping(trade.SceneField.TRANSLATION)), [0, 1, 2])
+        self.assertEqual(list(scene.mapping(trade.SceneField.ROTATION)), [0, 1, 2])
+        self.assertEqual(list(scene.mapping(trade.SceneField.SCALING)), [0, 1, 2])
+        self.assertEqual(list(scene.mapping(trade.SceneField.MESH)), [0, 1, 3])
+        self.assertEqual(list(scene.mapping(trade.SceneField.MESH_MATERIAL)), [0, 1, 3])
+        self.assertEqual(list(scene.mapping(scene_field_yes)), [0, 1])
+
+        # Object 1 has a bit field, so the scene gets rebuilt. The TRS and
+        # mesh/material fields have to stay sharing the mapping, otherwise
+        # the SceneData constructor would assert.
+        objects_to_keep = containers.BitArray.direct_init(scene.mapping_bound, True)
+        objects_to_keep[1] = False
+        filtered = scenetools.filter_objects(scene, objects_to_keep)
+        self.assertEqual(list(filtered.mapping(trade.SceneField.TRANSLATION)), [0, 2])
+        self.assertEqual(list(filtered.field(trade.SceneField.TRANSLATION)), [
+            Vector3(1.0, 2.0, 3.0),
+            Vector3(0.0)
+        ])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.ROTATION)), [0, 2])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.SCALING)), [0, 2])
+        self.assertEqual(list(filtered.field(trade.SceneField.SCALING)), [
+            Vector3(2.0),
+            Vector3(3.0)
+        ])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.MESH)), [0, 3])
+        self.assertEqual(list(filtered.field(trade.SceneField.MESH)), [0, 0])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.MESH_MATERIAL)), [0, 3])
+        self.assertEqual(list(filtered.field(trade.SceneField.MESH_MATERIAL)), [0, 0])
+        self.assertEqual(list(filtered.mapping(scene_field_yes)), [0])
+        self.assertEqual(list(filtered.field(scene_field_yes)), [True])
+        self.assertEqual(filtered.fields_as_dict()[scene_field_string][1], ['hello!', 'bye!'])
+
+        # Filtering just the string field copies the rest in full, again
+        # with the mappings shared
+        strings_to_keep = containers.BitArray.direct_init(2, True)
+        strings_to_keep[0] = False
+        filtered = scenetools.filter_field_entries(scene, [
+            (scene_field_string, strings_to_keep)
+        ])
+        self.assertEqual(list(filtered.mapping(scene_field_string)), [2])
+        self.assertEqual(filtered.fields_as_dict()[scene_field_string][1], ['bye!'])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.TRANSLATION)), [0, 1, 2])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.SCALING)), [0, 1, 2])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.MESH_MATERIAL)), [0, 1, 3])
+
+        # Filtering fields that share a mapping the same way is fine
+        trs_to_keep = containers.BitArray.direct_init(3, True)
+        trs_to_keep[1] = False
+        filtered = scenetools.filter_field_entries(scene, [
+            (scene_field_string, strings_to_keep),
+            (trade.SceneField.TRANSLATION, trs_to_keep),
+            (trade.SceneField.ROTATION, trs_to_keep),
+            (trade.SceneField.SCALING, trs_to_keep)
+        ])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.TRANSLATION)), [0, 2])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.ROTATION)), [0, 2])
+        self.assertEqual(list(filtered.mapping(trade.SceneField.SCALING)), [0, 2])
+
+        # But not differently, as the output couldn't share the mapping
+        with self.assertRaisesRegex(AssertionError, "field [0-9]+ shares mapping with field [0-9]+ but was filtered differently"):
+            scenetools.filter_field_entries(scene, [
+                (scene_field_string, strings_to_keep),
+                (trade.SceneField.TRANSLATION, trs_to_keep)
+            ])
+
     def test_objects_invalid_size(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
@@ -353,14 +487,20 @@ class Hierarchy(unittest.TestCase):
 
         parents_breadth_first = scenetools.parents_breadth_first(scene)
         children_depth_first = scenetools.children_depth_first(scene)
-        self.assertEqual(parents_breadth_first, [
+        self.assertIsInstance(parents_breadth_first, containers.MutableStridedArrayView1D)
+        self.assertIsInstance(children_depth_first, containers.MutableStridedArrayView1D)
+        self.assertEqual(parents_breadth_first.format, 'Ii')
+        self.assertEqual(children_depth_first.format, 'II')
+        self.assertEqual(parents_breadth_first.stride, (8, ))
+        self.assertIsNotNone(parents_breadth_first.owner)
+        self.assertEqual(list(parents_breadth_first), [
             # Root objects first, parent always before all its children
             (1, -1),
             (2, -1),
             (3, 2),
             (0, 3)
         ])
-        self.assertEqual(children_depth_first, [
+        self.assertEqual(list(children_depth_first), [
             # Object 1 has no children
             (1, 0),
             # Object 2 has one direct child and one grandchild, etc
@@ -369,6 +509,10 @@ class Hierarchy(unittest.TestCase):
                     (0, 0)
         ])
 
+        # The items are settable as well
+        parents_breadth_first[3] = (7, 1)
+        self.assertEqual(parents_breadth_first[3], (7, 1))
+
     def test_parents_breadth_first_children_depth_first_no_hierarchy(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), "scene.gltf"))
@@ -395,10 +539,16 @@ class Hierarchy(unittest.TestCase):
 
         transformations1 = scenetools.absolute_field_transformations2d(scene, trade.SceneField.MESH)
         transformations2 = scenetools.absolute_field_transformations2d(scene, scene.field_id(trade.SceneField.MESH))
-        self.assertEqual(len(transformations1), scene.field_size(trade.SceneField.MESH))
-        self.assertEqual(len(transformations2), scene.field_size(trade.SceneField.MESH))
-        self.assertEqual(transformations1[0], Matrix3.translation((-4.5, -3.0)))
-        self.assertEqual(transformations2[0], Matrix3.translation((-4.5, -3.0)))
+        self.assertIsInstance(transformations1, containers.MutableStridedArrayView3D)
+        self.assertEqual(transformations1.size, (scene.field_size(trade.SceneField.MESH), 3, 3))
+        self.assertEqual(transformations2.size, (scene.field_size(trade.SceneField.MESH), 3, 3))
+        self.assertEqual(transformations1.format, 'f')
+        self.assertIsNotNone(transformations1.owner)
+        # Rows and columns are in the same order as with the matrix buffer
+        # protocol, so each element converts back to a matrix
+        self.assertEqual(Matrix3(transformations1[0]), Matrix3.translation((-4.5, -3.0)))
+        self.assertEqual(Matrix3(transformations2[0]), Matrix3.translation((-4.5, -3.0)))
+        self.assertEqual(transformations1[0][0][2], -4.5)
 
     def test_absolute_field_transformations3d(self):
         # Static builds with non-static plugins cause assertions with non-owned
@@ -414,10 +564,18 @@ class Hierarchy(unittest.TestCase):
 
         transformations1 = scenetools.absolute_field_transformations3d(scene, trade.SceneField.MESH)
         transformations2 = scenetools.absolute_field_transformations3d(scene, scene.field_id(trade.SceneField.MESH))
-        self.assertEqual(len(transformations1), scene.field_size(trade.SceneField.MESH))
-        self.assertEqual(len(transformations2), scene.field_size(trade.SceneField.MESH))
-        self.assertEqual(transformations1[0], Matrix4.translation((-4.5, -3.0, 0.0)))
-        self.assertEqual(transformations2[0], Matrix4.translation((-4.5, -3.0, 0.0)))
+        self.assertIsInstance(transformations1, containers.MutableStridedArrayView3D)
+        self.assertEqual(transformations1.size, (scene.field_size(trade.SceneField.MESH), 4, 4))
+        self.assertEqual(transformations2.size, (scene.field_size(trade.SceneField.MESH), 4, 4))
+        self.assertEqual(transformations1.format, 'f')
+        self.assertIsNotNone(transformations1.owner)
+        self.assertEqual(Matrix4(transformations1[0]), Matrix4.translation((-4.5, -3.0, 0.0)))
+        self.assertEqual(Matrix4(transformations2[0]), Matrix4.translation((-4.5, -3.0, 0.0)))
+        self.assertEqual(transformations1[0][1][3], -3.0)
+
+        # The memory stays alive even after the scene is gone
+        del scene
+        self.assertEqual(Matrix4(transformations1[0]), Matrix4.translation((-4.5, -3.0, 0.0)))
 
     def test_absolute_field_transformations_not_found(self):
         # Static builds with non-static plugins cause assertions with non-owned
@@ -25,7 +25,9 @@
 #
 
 import array
+import concurrent.futures
 import os
+import pickle
 import platform
 import sys
 import tempfile
@@ -34,6 +36,7 @@ import unittest
 from corrade import containers, pluginmanager
 from magnum import *
 from magnum import primitives, scenetools, trade
+from magnum import animation as animation_
 import magnum
 
 class ImageData(unittest.TestCase):
@@ -191,6 +194,89 @@ class ImageData(unittest.TestCase):
         # TODO implement once there's a way to get immutable ImageData, either
         #   by "deserializing" a binary blob, or by mmapping a KTX file etc.
 
+    def test_pickle(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "rgb.png"))
+
+        image = importer.image2d(0)
+        for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(protocol=protocol):
+                unpickled = pickle.loads(pickle.dumps(image, protocol=protocol))
+                self.assertFalse(unpickled.is_compressed)
+                self.assertEqual(unpickled.storage.alignment, 1)
+                self.assertEqual(unpickled.format, PixelFormat.RGB8_UNORM)
+                self.assertEqual(unpickled.pixel_size, 3)
+                self.assertEqual(unpickled.size, Vector2i(3, 2))
+                self.assertEqual(bytes(unpickled.data), bytes(image.data))
+                self.assertIsNotNone(unpickled.owner)
+                # Mutable data are serialized as a bytearray, which is mutable
+                # again. Before Python 3.8 it's always bytes.
+                if sys.version_info >= (3, 8):
+                    self.assertEqual(unpickled.data_flags, trade.DataFlags.MUTABLE)
+                else:
+                    self.assertEqual(unpickled.data_flags, trade.DataFlags.NONE)
+
+    @unittest.skipUnless(sys.version_info >= (3, 8), "PickleBuffer is only since Python 3.8")
+    def test_pickle_out_of_band(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "rgb.png"))
+
+        image = importer.image2d(0)
+        image_refcount = sys.getrefcount(image)
+
+        buffers = []
+        data = pickle.dumps(image, protocol=5, buffer_callback=buffers.append)
+        self.assertEqual(len(buffers), 1)
+        unpickled = pickle.loads(data, buffers=buffers)
+        del buffers
+
+        # The unpickled image references the original memory
+        self.assertEqual(unpickled.data_flags, trade.DataFlags.MUTABLE)
+        self.assertEqual(bytes(unpickled.data), bytes(image.data))
+        self.assertIs(unpickled.owner.owner, image)
+        self.assertEqual(sys.getrefcount(image), image_refcount + 1)
+
+        del unpickled
+        self.assertEqual(sys.getrefcount(image), image_refcount)
+
+    @unittest.skipUnless(sys.version_info >= (3, 8), "PickleBuffer and shared_memory are only since Python 3.8")
+    def test_pickle_shared_memory(self):
+        from multiprocessing import shared_memory
+
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "rgb.png"))
+        image = importer.image2d(0)
+
+        buffers = []
+        data = pickle.dumps(image, protocol=5, buffer_callback=buffers.append)
+        self.assertEqual(len(buffers), 1)
+        size = buffers[0].raw().nbytes
+        exported = shared_memory.SharedMemory(create=True, size=size)
+        try:
+            exported.buf[:size] = buffers[0].raw()
+            del buffers
+
+            attached = shared_memory.SharedMemory(name=exported.name)
+            unpickled = pickle.loads(data, buffers=[attached.buf[:size].toreadonly()])
+            self.assertEqual(unpickled.data_flags, trade.DataFlags.NONE)
+            self.assertEqual(unpickled.size, Vector2i(3, 2))
+            self.assertEqual(bytes(unpickled.data), bytes(image.data))
+            self.assertIsNotNone(unpickled.owner)
+
+            del unpickled
+            attached.close()
+        finally:
+            exported.close()
+            exported.unlink()
+
+    def test_pickle_compressed(self):
+        importer = trade.ImporterManager().load_and_instantiate('DdsImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "rgba_dxt1.dds"))
+
+        image = importer.image2d(0)
+        with self.assertRaisesRegex(NotImplementedError, "pickling compressed images is not implemented yet, sorry"):
+            pickle.dumps(image)
+
     def test_pixels_access_unsupported_format(self):
         # The only way to get an image instance is through a manager
         importer = trade.ImporterManager().load_and_instantiate('DdsImporter')
@@ -832,6 +918,98 @@ class MeshData(unittest.TestCase):
         self.assertEqual(mesh.vertex_count, 21)
         self.assertEqual(mesh.attribute_count(), 0)
 
+    def test_init_buffers(self):
+        indices = array.array('H', [0, 1, 2, 2, 1, 0])
+        vertices = array.array('f', [1.0, 0.0,
+                                     0.0, 1.0,
+                                     -1.0, 0.0])
+        indices_refcount = sys.getrefcount(indices)
+        vertices_refcount = sys.getrefcount(vertices)
+
+        positions = trade.MeshAttributeData(trade.MeshAttribute.POSITION, VertexFormat.VECTOR2, containers.StridedArrayView1D(vertices).expanded(0, (3, 2)))
+        self.assertEqual(sys.getrefcount(vertices), vertices_refcount + 1)
+
+        mesh = trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, vertices, [positions])
+        self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+        # The data aren't owned by the mesh, but as the buffers are writable,
+        # they're mutable
+        self.assertEqual(mesh.index_data_flags, trade.DataFlags.MUTABLE)
+        self.assertEqual(mesh.vertex_data_flags, trade.DataFlags.MUTABLE)
+        self.assertTrue(mesh.is_indexed)
+        self.assertEqual(mesh.index_type, MeshIndexType.UNSIGNED_SHORT)
+        self.assertEqual(mesh.index_count, 6)
+        self.assertEqual(mesh.vertex_count, 3)
+        self.assertEqual(mesh.attribute_count(), 1)
+        self.assertEqual(mesh.attribute_offset(trade.MeshAttribute.POSITION), 0)
+        self.assertEqual(mesh.attribute_stride(trade.MeshAttribute.POSITION), 8)
+        self.assertEqual(list(mesh.indices), [0, 1, 2, 2, 1, 0])
+        self.assertEqual(list(mesh.attribute(trade.MeshAttribute.POSITION)), [
+            Vector2(1.0, 0.0),
+            Vector2(0.0, 1.0),
+            Vector2(-1.0, 0.0)
+        ])
+
+        # Both buffers are referenced by the mesh
+        self.assertEqual(mesh.owner, (indices, vertices))
+        self.assertEqual(sys.getrefcount(indices), indices_refcount + 1)
+        self.assertEqual(sys.getrefcount(vertices), vertices_refcount + 2)
+
+        # No copy was made, modifications are visible in the original data
+        mesh.mutable_indices[1] = 2
+        mesh.mutable_attribute(trade.MeshAttribute.POSITION)[0] = Vector2(0.5, 0.25)
+        self.assertEqual(list(indices), [0, 2, 2, 2, 1, 0])
+        self.assertEqual(list(vertices)[:2], [0.5, 0.25])
+
+        del positions
+        self.assertEqual(sys.getrefcount(vertices), vertices_refcount + 1)
+
+        del mesh
+        self.assertEqual(sys.getrefcount(indices), indices_refcount)
+        self.assertEqual(sys.getrefcount(vertices), vertices_refcount)
+
+    def test_init_buffers_nonindexed(self):
+        data = b'\x03\x00\x07\x00\x10\x00\x2e\x75'
+        data_refcount = sys.getrefcount(data)
+
+        mesh = trade.MeshData(MeshPrimitive.POINTS, data, [
+            trade.MeshAttributeData(trade.MeshAttribute.OBJECT_ID, VertexFormat.UNSIGNED_SHORT, memoryview(data).cast('H'))
+        ])
+        self.assertFalse(mesh.is_indexed)
+        # Bytes are immutable, so the data are as well
+        self.assertEqual(mesh.index_data_flags, trade.DataFlags.NONE)
+        self.assertEqual(mesh.vertex_data_flags, trade.DataFlags.NONE)
+        self.assertEqual(mesh.vertex_count, 4)
+        self.assertEqual(list(mesh.attribute(trade.MeshAttribute.OBJECT_ID)), [3, 7, 16, 29998])
+        self.assertIs(mesh.owner, data)
+        self.assertEqual(sys.getrefcount(data), data_refcount + 1)
+
+        # Explicit vertex count with no attributes
+        mesh = trade.MeshData(MeshPrimitive.POINTS, data, [], vertex_count=15)
+        self.assertEqual(mesh.vertex_count, 15)
+        self.assertEqual(mesh.attribute_count(), 0)
+
+        del mesh
+        self.assertEqual(sys.getrefcount(data), data_refcount)
+
+    def test_init_buffers_invalid(self):
+        indices = array.array('H', [0, 1, 2])
+        vertices = array.array('f', [1.0, 0.0, 0.0, 1.0, -1.0, 0.0])
+        positions = trade.MeshAttributeData(trade.MeshAttribute.POSITION, VertexFormat.VECTOR2, containers.StridedArrayView1D(vertices).expanded(0, (3, 2)))
+        weights = trade.MeshAttributeData(trade.MeshAttribute.WEIGHTS, VertexFormat.FLOAT, containers.StridedArrayView1D(vertices).expanded(0, (3, 2))[:2], array_size=2)
+
+        with self.assertRaisesRegex(AssertionError, "expected index data type to be B, H or I but got f"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, vertices, vertices, vertices, [positions])
+        with self.assertRaisesRegex(AssertionError, "indices are not contained in passed index data"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, array.array('H', [0, 1, 2]), indices, vertices, [positions])
+        with self.assertRaisesRegex(AssertionError, "attribute 0 is not contained in passed vertex data"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, indices, indices, array.array('f', [0.0]*6), [positions])
+        with self.assertRaisesRegex(AssertionError, "attribute 1 has 2 vertices but 3 expected"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, vertices, [positions, weights])
+        with self.assertRaisesRegex(AssertionError, "attribute 0 has 3 vertices but 5 expected"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, vertices, [positions], vertex_count=5)
+        with self.assertRaisesRegex(AssertionError, "vertex count can't be implicit if there are no attributes"):
+            trade.MeshData(MeshPrimitive.TRIANGLES, vertices, [])
+
     def test(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         # This adds extra attributes for joints and weights, don't want
@@ -1151,6 +1329,114 @@ class MeshData(unittest.TestCase):
         with self.assertRaisesRegex(AttributeError, "mesh vertex data is not mutable"):
             mesh.mutable_attribute(trade.MeshAttribute.POSITION)
 
+    def test_pickle(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        # Indexed and non-indexed
+        for mesh in [importer.mesh(0), importer.mesh(1)]:
+            for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+                with self.subTest(protocol=protocol, indexed=mesh.is_indexed):
+                    unpickled = pickle.loads(pickle.dumps(mesh, protocol=protocol))
+                    self.assertEqual(unpickled.primitive, mesh.primitive)
+                    self.assertEqual(unpickled.vertex_count, mesh.vertex_count)
+                    self.assertEqual(unpickled.is_indexed, mesh.is_indexed)
+                    if mesh.is_indexed:
+                        self.assertEqual(unpickled.index_type, mesh.index_type)
+                        self.assertEqual(unpickled.index_offset, mesh.index_offset)
+                        self.assertEqual(list(unpickled.indices), list(mesh.indices))
+                    self.assertEqual(unpickled.attribute_count(), mesh.attribute_count())
+                    for i in range(mesh.attribute_count()):
+                        self.assertEqual(unpickled.attribute_name(i), mesh.attribute_name(i))
+                        self.assertEqual(unpickled.attribute_format(i), mesh.attribute_format(i))
+                        self.assertEqual(unpickled.attribute_offset(i), mesh.attribute_offset(i))
+                        self.assertEqual(unpickled.attribute_stride(i), mesh.attribute_stride(i))
+                        self.assertEqual(list(unpickled.attribute(i)), list(mesh.attribute(i)))
+
+    @unittest.skipUnless(sys.version_info >= (3, 8), "PickleBuffer is only since Python 3.8")
+    def test_pickle_out_of_band(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        mesh = importer.mesh(0)
+        mesh_refcount = sys.getrefcount(mesh)
+
+        buffers = []
+        data = pickle.dumps(mesh, protocol=5, buffer_callback=buffers.append)
+        self.assertEqual(len(buffers), 2)
+        unpickled = pickle.loads(data, buffers=buffers)
+        del buffers
+
+        # The unpickled mesh references the original index and vertex memory
+        self.assertEqual(unpickled.index_data_flags, trade.DataFlags.MUTABLE)
+        self.assertEqual(unpickled.vertex_data_flags, trade.DataFlags.MUTABLE)
+        self.assertEqual(list(unpickled.indices), list(mesh.indices))
+        self.assertIsInstance(unpickled.owner, tuple)
+        self.assertIs(unpickled.owner[0].owner, mesh)
+        self.assertIs(unpickled.owner[1].owner, mesh)
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount + 2)
+
+        # Modifications are visible in the original
+        unpickled.mutable_indices[0] = 2
+        self.assertEqual(mesh.indices[0], 2)
+
+        del unpickled
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount)
+
+    @unittest.skipUnless(sys.version_info >= (3, 8), "PickleBuffer and shared_memory are only since Python 3.8")
+    def test_pickle_shared_memory(self):
+        from multiprocessing import shared_memory
+
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+        mesh = importer.mesh(0)
+
+        # Exporting side, copying the out-of-band buffers into a shared memory
+        # segment at 16-byte aligned offsets
+        buffers = []
+        data = pickle.dumps(mesh, protocol=5, buffer_callback=buffers.append)
+        ranges = []
+        size = 0
+        for buffer in buffers:
+            ranges += [(size, buffer.raw().nbytes)]
+            size += (buffer.raw().nbytes + 15)//16*16
+        exported = shared_memory.SharedMemory(create=True, size=size)
+        try:
+            for buffer, (offset, length) in zip(buffers, ranges):
+                exported.buf[offset:offset + length] = buffer.raw()
+            del buffers
+
+            # Attaching side, referencing the segment read-only
+            attached = shared_memory.SharedMemory(name=exported.name)
+            unpickled = pickle.loads(data, buffers=[attached.buf[offset:offset + length].toreadonly() for offset, length in ranges])
+            self.assertEqual(unpickled.index_data_flags, trade.DataFlags.NONE)
+            self.assertEqual(unpickled.vertex_data_flags, trade.DataFlags.NONE)
+            self.assertEqual(list(unpickled.indices), list(mesh.indices))
+            self.assertEqual(list(unpickled.attribute(trade.MeshAttribute.POSITION)), list(mesh.attribute(trade.MeshAttribute.POSITION)))
+
+            # The data reference the segment directly, so changes made by the
+            # exporting side are visible. The owners keep the mapping alive,
+            # which means it can't be closed while the mesh exists.
+            exported.buf[ranges[0][0]] = 2
+            self.assertEqual(unpickled.indices[0], 2)
+            with self.assertRaises(BufferError):
+                attached.close()
+
+            del unpickled
+            attached.close()
+        finally:
+            exported.close()
+            exported.unlink()
+
+    def test_pickle_global(self):
+        mesh = primitives.cube_solid()
+        self.assertEqual(mesh.vertex_data_flags, trade.DataFlags.GLOBAL)
+
+        unpickled = pickle.loads(pickle.dumps(mesh))
+        self.assertEqual(unpickled.vertex_data_flags, trade.DataFlags.NONE)
+        self.assertEqual(list(unpickled.indices), list(mesh.indices))
+        self.assertEqual(list(unpickled.attribute(trade.MeshAttribute.POSITION)), list(mesh.attribute(trade.MeshAttribute.POSITION)))
+
     def test_nonindexed(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
@@ -1257,16 +1543,43 @@ class MeshData(unittest.TestCase):
         importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
 
         mesh = importer.mesh(0)
+        mesh_refcount = sys.getrefcount(mesh)
         joint_ids_id = mesh.attribute_id(trade.MeshAttribute.JOINT_IDS)
+        self.assertEqual(mesh.attribute_array_size(joint_ids_id), 4)
+
+        # Array attributes are 2D views with the second dimension being the
+        # array elements
+        joint_ids = mesh.attribute(joint_ids_id)
+        self.assertIsInstance(joint_ids, containers.StridedArrayView2D)
+        self.assertEqual(joint_ids.size, (3, 4))
+        self.assertEqual(joint_ids.stride, (28, 1))
+        self.assertEqual(joint_ids.format, 'B')
+        self.assertIs(joint_ids.owner, mesh)
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount + 1)
+        self.assertEqual(joint_ids.tolist(), [
+            [255, 51, 102, 3],
+            [51, 102, 255, 0],
+            [103, 255, 51, 7]
+        ])
+
+        del joint_ids
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount)
 
-        with self.assertRaisesRegex(NotImplementedError, "array attributes not implemented yet, sorry"):
-            mesh.attribute(joint_ids_id)
-        with self.assertRaisesRegex(NotImplementedError, "array attributes not implemented yet, sorry"):
-            mesh.mutable_attribute(joint_ids_id)
-        with self.assertRaisesRegex(NotImplementedError, "array attributes not implemented yet, sorry"):
-            mesh.attribute(trade.MeshAttribute.JOINT_IDS)
-        with self.assertRaisesRegex(NotImplementedError, "array attributes not implemented yet, sorry"):
-            mesh.mutable_attribute(trade.MeshAttribute.JOINT_IDS)
+        weights = mesh.attribute(trade.MeshAttribute.WEIGHTS)
+        self.assertEqual(weights.size, (3, 4))
+        self.assertEqual(weights.stride, (28, 4))
+        self.assertEqual(weights.format, 'f')
+        self.assertEqual(weights[1].tolist(), [0.0, 1.0, 0.5, 0.30000001192092896])
+
+        # Mutable access gives a mutable 2D view on the same memory
+        mutable_joint_ids = mesh.mutable_attribute(trade.MeshAttribute.JOINT_IDS)
+        self.assertIsInstance(mutable_joint_ids, containers.MutableStridedArrayView2D)
+        self.assertEqual(mutable_joint_ids.size, (3, 4))
+        mutable_joint_ids[2, 3] = 15
+        self.assertEqual(mesh.attribute(joint_ids_id)[2, 3], 15)
+        mutable_weights = mesh.mutable_attribute(mesh.attribute_id(trade.MeshAttribute.WEIGHTS))
+        mutable_weights[0, 1] = 0.75
+        self.assertEqual(weights[0, 1], 0.75)
 
     def test_attribute_access_unsupported_format(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
@@ -2102,6 +2415,49 @@ class SceneData(unittest.TestCase):
         mutable_pointer[1] = 0xdeadbeef
         self.assertEqual(pointer[1], 0xdeadbeef)
 
+    def test_pickle(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'scene.gltf'))
+
+        scene = importer.scene(0)
+        for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(protocol=protocol):
+                unpickled = pickle.loads(pickle.dumps(scene, protocol=protocol))
+                self.assertEqual(unpickled.mapping_type, scene.mapping_type)
+                self.assertEqual(unpickled.mapping_bound, scene.mapping_bound)
+                self.assertEqual(unpickled.field_count, scene.field_count)
+                for i in range(scene.field_count):
+                    self.assertEqual(unpickled.field_name(i), scene.field_name(i))
+                    self.assertEqual(unpickled.field_type(i), scene.field_type(i))
+                    self.assertEqual(unpickled.field_size(i), scene.field_size(i))
+                    self.assertEqual(unpickled.field_flags(i), scene.field_flags(i))
+                    self.assertEqual(list(unpickled.mapping(i)), list(scene.mapping(i)))
+                for field in [trade.SceneField.PARENT, trade.SceneField.TRANSLATION, trade.SceneField.CAMERA]:
+                    self.assertEqual(list(unpickled.field(field)), list(scene.field(field)))
+
+    @unittest.skipUnless(sys.version_info >= (3, 8), "PickleBuffer is only since Python 3.8")
+    def test_pickle_out_of_band(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'scene.gltf'))
+
+        scene = importer.scene(0)
+        scene_refcount = sys.getrefcount(scene)
+
+        buffers = []
+        data = pickle.dumps(scene, protocol=5, buffer_callback=buffers.append)
+        self.assertEqual(len(buffers), 1)
+        unpickled = pickle.loads(data, buffers=buffers)
+        del buffers
+
+        # The unpickled scene references the original memory
+        self.assertEqual(unpickled.data_flags, trade.DataFlags.MUTABLE)
+        self.assertEqual(list(unpickled.field(trade.SceneField.TRANSLATION)), list(scene.field(trade.SceneField.TRANSLATION)))
+        self.assertIs(unpickled.owner.owner, scene)
+        self.assertEqual(sys.getrefcount(scene), scene_refcount + 1)
+
+        del unpickled
+        self.assertEqual(sys.getrefcount(scene), scene_refcount)
+
     def test_data_access_not_mutable(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
         importer.open_file(os.path.join(os.path.dirname(__file__), 'scene.gltf'))
@@ -2201,9 +2557,97 @@ class SceneData(unittest.TestCase):
             scene.field_object_offset(trade.SceneField.PARENT, 1, scene.field_size(trade.SceneField.PARENT) + 1)
 
     def test_field_access_array(self):
-        pass
-        # TODO implement once there's some importer that gives back arrays
+        # TODO switch to an importer once there's one that gives back arrays
         #   (gltf? not sure)
+        mapping = array.array('I', [0, 3, 1])
+        data = array.array('H', [0x3333, 0x6666, 0xffff, 0xcccc, 0xaaaa, 0x9999])
+        bits = containers.BitArray.value_init(3*2)
+        bits[1] = True
+        bits[4] = True
+        scene = scenetools.combine_fields(trade.SceneMappingType.UNSIGNED_INT, 4, [
+            trade.SceneFieldData(trade.SceneField.CUSTOM(1),
+                trade.SceneMappingType.UNSIGNED_INT, mapping,
+                trade.SceneFieldType.UNSIGNED_SHORT, containers.StridedArrayView1D(data).expanded(0, (3, 2)),
+                field_array_size=2),
+            trade.SceneFieldData(trade.SceneField.CUSTOM(2),
+                trade.SceneMappingType.UNSIGNED_INT, mapping,
+                containers.StridedBitArrayView1D(bits).expanded(0, (3, 2)))
+        ])
+        scene_refcount = sys.getrefcount(scene)
+        self.assertEqual(scene.field_array_size(0), 2)
+        self.assertEqual(scene.field_array_size(1), 2)
+
+        # Array fields are 2D views with the second dimension being the array
+        # elements
+        field = scene.field(trade.SceneField.CUSTOM(1))
+        self.assertIsInstance(field, containers.StridedArrayView2D)
+        self.assertEqual(field.size, (3, 2))
+        self.assertEqual(field.stride, (4, 2))
+        self.assertEqual(field.format, 'H')
+        self.assertIs(field.owner, scene)
+        self.assertEqual(sys.getrefcount(scene), scene_refcount + 1)
+        self.assertEqual(field.tolist(), [[0x3333, 0x6666], [0xffff, 0xcccc], [0xaaaa, 0x9999]])
+        self.assertEqual(scene.field(0).tolist(), field.tolist())
+
+        del field
+        self.assertEqual(sys.getrefcount(scene), scene_refcount)
+
+        # Bit array fields are 2D bit views
+        field_bits = scene.field(1)
+        self.assertIsInstance(field_bits, containers.StridedBitArrayView2D)
+        self.assertEqual(field_bits.size, (3, 2))
+        self.assertEqual([[field_bits[i, j] for j in range(2)] for i in range(3)], [[False, True], [False, False], [True, False]])
+        self.assertIs(field_bits.owner, scene)
+
+        # Mutable access
+        mutable_field = scene.mutable_field(0)
+        self.assertIsInstance(mutable_field, containers.MutableStridedArrayView2D)
+        mutable_field[2, 1] = 0x1111
+        self.assertEqual(scene.field(0)[2, 1], 0x1111)
+        mutable_field_bits = scene.mutable_field(trade.SceneField.CUSTOM(2))
+        self.assertIsInstance(mutable_field_bits, containers.MutableStridedBitArrayView2D)
+        mutable_field_bits[1, 0] = True
+        self.assertTrue(scene.field(1)[1, 0])
+
+    def test_fields_as_dict(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'scene.gltf'))
+        scene_field_yes = importer.scene_field_for_name('yes')
+        string_field = importer.scene_field_for_name('aString')
+
+        scene = importer.scene(0)
+        scene_refcount = sys.getrefcount(scene)
+
+        fields = scene.fields_as_dict()
+        self.assertEqual(len(fields), scene.field_count)
+        self.assertEqual(list(fields.keys()), [scene.field_name(i) for i in range(scene.field_count)])
+
+        mapping, translations = fields[trade.SceneField.TRANSLATION]
+        self.assertIsInstance(translations, containers.StridedArrayView1D)
+        self.assertEqual(list(mapping), list(scene.mapping(trade.SceneField.TRANSLATION)))
+        self.assertEqual(list(translations), [
+            Vector3(1, 2, 3),
+            Vector3(4, 5, 6),
+            Vector3(7, 8, 9)
+        ])
+        self.assertIs(mapping.owner, scene)
+        self.assertIs(translations.owner, scene)
+
+        # Bit fields are bit views
+        mapping, yeses = fields[scene_field_yes]
+        self.assertIsInstance(yeses, containers.StridedBitArrayView1D)
+        self.assertEqual(list(yeses), [True, False])
+
+        # String fields, which can't be accessed via field(), are converted to
+        # a list
+        mapping, strings = fields[string_field]
+        self.assertEqual(list(mapping), list(scene.mapping(string_field)))
+        self.assertEqual(strings, ['hello!'])
+
+        # All views reference the scene
+        self.assertGreater(sys.getrefcount(scene), scene_refcount)
+        del fields, mapping, translations, yeses, strings
+        self.assertEqual(sys.getrefcount(scene), scene_refcount)
 
     def test_field_access_unsupported_type(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
@@ -2223,6 +2667,134 @@ class SceneData(unittest.TestCase):
         with self.assertRaisesRegex(NotImplementedError, "access to SceneFieldType.STRING_OFFSET32 is not implemented yet, sorry"):
             scene.mutable_field(string_field)
 
+class AnimationData(unittest.TestCase):
+    def test_custom_target(self):
+        a = trade.AnimationTrackTarget.CUSTOM(17)
+        self.assertTrue(a.is_custom)
+        self.assertEqual(a.custom_value, 17)
+        self.assertEqual(a.name, "CUSTOM(17)")
+        self.assertEqual(str(a), "AnimationTrackTarget.CUSTOM(17)")
+
+        with self.assertRaisesRegex(ValueError, "custom value too large"):
+            trade.AnimationTrackTarget.CUSTOM(0x8000)
+
+        b = trade.AnimationTrackTarget.ROTATION3D
+        self.assertFalse(b.is_custom)
+        with self.assertRaisesRegex(AttributeError, "not a custom value"):
+            b.custom_value
+
+    def test(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        animation = importer.animation(0)
+        self.assertEqual(animation.data_flags, trade.DataFlags.OWNED|trade.DataFlags.MUTABLE)
+        self.assertEqual(animation.duration, Range1D(0.0, 2.0))
+        self.assertEqual(animation.track_count, 2)
+
+        self.assertEqual(animation.track_type(0), trade.AnimationTrackType.VECTOR3)
+        self.assertEqual(animation.track_result_type(0), trade.AnimationTrackType.VECTOR3)
+        self.assertEqual(animation.track_target_name(0), trade.AnimationTrackTarget.TRANSLATION3D)
+        self.assertEqual(animation.track_target(0), 0)
+        self.assertEqual(animation.track_interpolation(0), animation_.Interpolation.LINEAR)
+        self.assertEqual(animation.track_before(0), animation_.Extrapolation.CONSTANT)
+        self.assertEqual(animation.track_after(0), animation_.Extrapolation.CONSTANT)
+        self.assertEqual(animation.track_type(1), trade.AnimationTrackType.QUATERNION)
+        self.assertEqual(animation.track_target_name(1), trade.AnimationTrackTarget.ROTATION3D)
+
+        keys = animation.track_keys(0)
+        values = animation.track_values(0)
+        self.assertEqual(keys.format, 'f')
+        self.assertEqual(values.format, '3f')
+        self.assertIs(keys.owner, animation)
+        self.assertIs(values.owner, animation)
+        self.assertEqual(list(keys), [0.0, 1.0, 2.0])
+        self.assertEqual(list(values), [
+            Vector3(0.0, 0.0, 0.0),
+            Vector3(1.0, 2.0, 3.0),
+            Vector3(3.0, 2.0, 1.0)
+        ])
+        self.assertEqual(animation.track_values(1).format, '4f')
+        self.assertEqual(animation.track_values(1)[2], Quaternion((0.0, 0.0, 1.0), 0.0))
+
+        # The data are owned and mutable
+        mutable_values = animation.mutable_track_values(0)
+        mutable_values[2] = Vector3(5.0, 4.0, 3.0)
+        self.assertEqual(values[2], Vector3(5.0, 4.0, 3.0))
+        mutable_keys = animation.mutable_track_keys(0)
+        self.assertEqual(mutable_keys.format, 'f')
+
+    def test_sample(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        animation = importer.animation(0)
+        times = array.array('f', [-1.0, 0.0, 0.5, 1.5, 3.0])
+
+        translations = animation.sample(0, times)
+        self.assertEqual(translations.size, (5, 3))
+        self.assertEqual(translations.format, 'f')
+        self.assertEqual([list(i) for i in translations], [
+            [0.0, 0.0, 0.0], # extrapolated as constant
+            [0.0, 0.0, 0.0],
+            [0.5, 1.0, 1.5],
+            [2.0, 2.0, 2.0],
+            [3.0, 2.0, 1.0]  # extrapolated as constant
+        ])
+
+        rotations = animation.sample(1, times)
+        self.assertEqual(rotations.size, (5, 4))
+        self.assertAlmostEqual(rotations[2][2], 0.3826834, delta=1.0e-6)
+        self.assertAlmostEqual(rotations[2][3], 0.9238795, delta=1.0e-6)
+
+        # Sampling more tracks at once
+        both = animation.sample([0, 0], times)
+        self.assertEqual(both.size, (2, 5, 3))
+        self.assertEqual(list(both[1][2]), [0.5, 1.0, 1.5])
+
+        # Sampling into an existing view
+        dst = containers.MutableStridedArrayView1D(array.array('f', [0.0]*30)).expanded(0, (2, 5, 3))
+        animation.sample_into([0, 0], times, dst)
+        self.assertEqual(list(dst[0][3]), [2.0, 2.0, 2.0])
+        self.assertEqual(list(dst[1][4]), [3.0, 2.0, 1.0])
+
+    def test_sample_invalid(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        animation = importer.animation(0)
+        times = array.array('f', [0.0, 1.0])
+
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.sample(2, times)
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.sample([0, 2], times)
+        with self.assertRaisesRegex(AssertionError, "expected track 1 to have 3 result components like track 0, got 4"):
+            animation.sample([0, 1], times)
+        with self.assertRaisesRegex(AssertionError, "expected times to be a view of 32-bit floats, got d"):
+            animation.sample(0, array.array('d', [0.0, 1.0]))
+
+        dst = containers.MutableStridedArrayView1D(array.array('f', [0.0]*12)).expanded(0, (2, 2, 3))
+        with self.assertRaisesRegex(AssertionError, "expected dst to have a size of \\(1, 2, 3\\), got \\(2, 2, 3\\)"):
+            animation.sample_into([0], times, dst)
+        dst_int = containers.MutableStridedArrayView1D(array.array('i', [0]*6)).expanded(0, (1, 2, 3))
+        with self.assertRaisesRegex(AssertionError, "expected dst to be a view of 32-bit floats, got i"):
+            animation.sample_into([0], times, dst_int)
+
+    def test_track_oob(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        animation = importer.animation(0)
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.track_type(2)
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.track_keys(2)
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.track_values(2)
+        with self.assertRaisesRegex(IndexError, "index 2 out of range for 2 tracks"):
+            animation.mutable_track_values(2)
+
 class TextureData(unittest.TestCase):
     def test(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
@@ -2555,6 +3127,76 @@ class Importer(unittest.TestCase):
         with self.assertRaisesRegex(AssertionError, "feature not supported"):
             importer.open_data(b'')
 
+    def test_open_data_borrow(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+
+        with open(os.path.join(os.path.dirname(__file__), "rgb.png"), 'rb') as f:
+            data = f.read()
+        data_refcount = sys.getrefcount(data)
+
+        # The importer references the data until closed
+        importer.open_data(data, borrow=True)
+        self.assertEqual(sys.getrefcount(data), data_refcount + 1)
+
+        image = importer.image2d(0)
+        self.assertEqual(image.size, Vector2i(3, 2))
+        # Whether the data are copied or reference the borrowed memory depends
+        # on the plugin, if they reference it, the data object is the owner
+        if image.data_flags & trade.DataFlags.OWNED:
+            self.assertIsNone(image.owner)
+        else:
+            self.assertIs(image.owner, data)
+
+        importer.close()
+        del image
+        self.assertEqual(sys.getrefcount(data), data_refcount)
+
+        # Opening without borrowing doesn't reference the data
+        importer.open_data(data)
+        self.assertEqual(sys.getrefcount(data), data_refcount)
+
+    def test_open_data_borrow_not_supported(self):
+        importer = trade.ImporterManager().load_and_instantiate('AnySceneImporter')
+
+        with self.assertRaisesRegex(AssertionError, "feature not supported"):
+            importer.open_data(b'', borrow=True)
+
+    def test_open_file_mmap(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        # The external mesh.bin is mapped through a file callback as well
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'), mmap=True)
+        self.assertEqual(importer.mesh_count, 5)
+
+        mesh = importer.mesh(0)
+        self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+        # Whether the data are copied or reference the mapped file depends on
+        # the plugin, if they reference it, the mapping is the owner
+        if mesh.vertex_data_flags & trade.DataFlags.OWNED:
+            self.assertIsNone(mesh.owner)
+        else:
+            self.assertIsNotNone(mesh.owner)
+
+        # Closing the importer keeps the mapping alive for the mesh
+        importer.close()
+        self.assertFalse(importer.is_opened)
+        self.assertEqual(mesh.vertex_count, 3)
+
+        # Opening a file without mmap afterwards works as before
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+        self.assertIsNone(importer.mesh(0).owner)
+
+    def test_open_file_mmap_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+
+        with self.assertRaisesRegex(RuntimeError, "opening nonexistent.png failed"):
+            importer.open_file('nonexistent.png', mmap=True)
+
+    def test_open_file_mmap_not_supported(self):
+        importer = trade.ImporterManager().load_and_instantiate('AnySceneImporter')
+
+        with self.assertRaisesRegex(AssertionError, "feature not supported"):
+            importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'), mmap=True)
+
     def test_scene(self):
         # importer refcounting tested in image2d
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
@@ -2604,6 +3246,30 @@ class Importer(unittest.TestCase):
         with self.assertRaisesRegex(RuntimeError, "import failed"):
             importer.scene("A broken scene")
 
+    def test_animation(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+        self.assertEqual(importer.animation_count, 1)
+        self.assertEqual(importer.animation_name(0), 'Wiggle')
+        self.assertEqual(importer.animation_for_name('Wiggle'), 0)
+
+        animation = importer.animation(0)
+        self.assertEqual(animation.track_count, 2)
+
+    def test_animation_by_name(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        animation = importer.animation('Wiggle')
+        self.assertEqual(animation.track_count, 2)
+
+    def test_animation_by_name_not_found(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'animation.gltf'))
+
+        with self.assertRaisesRegex(KeyError, "name Nonexistent not found among 1 entries"):
+            importer.animation('Nonexistent')
+
     def test_mesh(self):
         # importer refcounting tested in image2d
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
@@ -2677,6 +3343,43 @@ class Importer(unittest.TestCase):
         with self.assertRaisesRegex(RuntimeError, "import failed"):
             importer.mesh('A broken mesh')
 
+    def test_meshes(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'two-meshes.gltf'))
+
+        meshes = importer.meshes()
+        self.assertEqual(len(meshes), importer.mesh_count)
+        for mesh in meshes:
+            self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+            self.assertIsNone(mesh.owner)
+
+        meshes = importer.meshes([1, 0, 1])
+        self.assertEqual(len(meshes), 3)
+        self.assertEqual(meshes[0].vertex_count, importer.mesh(1).vertex_count)
+        self.assertEqual(meshes[1].vertex_count, importer.mesh(0).vertex_count)
+
+        self.assertEqual(importer.meshes([]), [])
+
+    def test_meshes_oob(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+
+        with self.assertRaisesRegex(AssertionError, "no file opened"):
+            importer.meshes()
+
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        with self.assertRaisesRegex(IndexError, "index 5 out of range for 5 entries"):
+            importer.meshes([0, 5])
+        with self.assertRaisesRegex(IndexError, "level 1 out of range for 1 entries"):
+            importer.meshes([0], 1)
+
+    def test_meshes_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        with self.assertRaisesRegex(RuntimeError, "import of entry 2 failed"):
+            importer.meshes([0, 2])
+
     def test_material(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
 
@@ -2711,6 +3414,19 @@ class Importer(unittest.TestCase):
         with self.assertRaisesRegex(RuntimeError, "import failed"):
             importer.material("A broken material")
 
+    def test_materials(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'material.gltf'))
+
+        materials = importer.materials([2, 0])
+        self.assertEqual(len(materials), 2)
+        self.assertEqual(materials[0].layer_count, 2)
+
+        with self.assertRaisesRegex(IndexError, "index 5 out of range for 5 entries"):
+            importer.materials([5])
+        with self.assertRaisesRegex(RuntimeError, "import of entry 3 failed"):
+            importer.materials()
+
     def test_texture(self):
         importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
 
@@ -2808,6 +3524,170 @@ class Importer(unittest.TestCase):
         with self.assertRaisesRegex(RuntimeError, "import failed"):
             importer.image2d('A broken image')
 
+    def test_images2d(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+
+        images = importer.images2d()
+        self.assertEqual(len(images), 1)
+        self.assertEqual(images[0].size, Vector2i(3, 2))
+
+        with self.assertRaisesRegex(IndexError, "index 1 out of range for 1 entries"):
+            importer.images2d([1])
+
+    def test_threads(self):
+        # Each thread has its own manager, as the plugin manager itself isn't
+        # thread-safe and importers may load other plugins on their own
+        def import_mesh(filename):
+            importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+            importer.open_file(os.path.join(os.path.dirname(__file__), filename))
+            return importer.mesh(0)
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+            meshes = list(executor.map(import_mesh, ['mesh.gltf']*8))
+
+        self.assertEqual(len(meshes), 8)
+        for mesh in meshes:
+            self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+            self.assertIsNone(mesh.owner)
+
+    def test_busy_flag_reset(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        # The busy flag gets reset after each call, so subsequent calls work
+        importer.mesh(0)
+        self.assertEqual(importer.mesh_count, 5)
+        importer.close()
+        self.assertFalse(importer.is_opened)
+
+    def test_used_from_multiple_threads(self):
+        importer = trade.ImporterManager().load_and_instantiate('GltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.gltf'))
+
+        # Whether the calls overlap depends on scheduling, but each either
+        # succeeds or fails with the busy error, never racing on the instance
+        def import_meshes(_):
+            busy = 0
+            for i in range(200):
+                try:
+                    self.assertEqual(importer.mesh(0).primitive, MeshPrimitive.TRIANGLES)
+                except RuntimeError as e:
+                    self.assertEqual(str(e), "importer is being used from another thread")
+                    busy += 1
+            return busy
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+            busy = sum(executor.map(import_meshes, range(4)))
+
+        # Not every call can fail
+        self.assertLess(busy, 4*200)
+        # The flag is reset after, so the importer is usable again
+        self.assertEqual(importer.mesh(0).primitive, MeshPrimitive.TRIANGLES)
+
+class ImportPool(unittest.TestCase):
+    def test(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter', thread_count=3)
+        self.assertEqual(pool.thread_count, 3)
+
+        pool.close()
+        self.assertEqual(pool.thread_count, 0)
+
+    def test_default_thread_count(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter')
+        self.assertGreaterEqual(pool.thread_count, 1)
+
+    def test_plugin_not_found(self):
+        with self.assertRaisesRegex(RuntimeError, "can't load and instantiate plugin NonexistentImporter"):
+            trade.ImportPool(trade.ImporterManager(), 'NonexistentImporter')
+
+    def test_manager_state(self):
+        manager = trade.ImporterManager()
+        # The initial configuration gets used by the workers as well
+        manager.metadata('StbImageImporter').configuration['forceChannelCount'] = '4'
+        # Same for preferred plugins, the workers use StbImageImporter
+        # (affected by the above configuration) even if a PngImporter is
+        # available
+        manager.set_preferred_plugins('PngImporter', ['StbImageImporter'])
+        self.assertEqual(manager.metadata('PngImporter').name, 'StbImageImporter')
+
+        pool = trade.ImportPool(manager, 'PngImporter', thread_count=2)
+        filenames = [os.path.join(os.path.dirname(__file__), 'rgb.png')]*3
+        for i, image in pool.images2d(filenames):
+            self.assertEqual(image.format, PixelFormat.RGBA8_UNORM)
+
+    def test_meshes(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter', thread_count=3)
+        filenames = [os.path.join(os.path.dirname(__file__), i) for i in ['mesh.gltf', 'two-meshes.gltf']*4]
+
+        # The results arrive in arbitrary order, but each file exactly once
+        meshes = {}
+        for i, mesh in pool.meshes(filenames):
+            self.assertNotIn(i, meshes)
+            self.assertIsInstance(mesh, trade.MeshData)
+            self.assertIsNone(mesh.owner)
+            meshes[i] = mesh
+        self.assertEqual(sorted(meshes.keys()), list(range(8)))
+        for i in range(0, 8, 2):
+            self.assertEqual(meshes[i].primitive, MeshPrimitive.TRIANGLES)
+
+        # The pool can be reused once the iteration is done
+        self.assertEqual(len(list(pool.meshes(filenames[:3], id=1))), 3)
+
+    def test_images2d(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'StbImageImporter', thread_count=2)
+        filenames = [os.path.join(os.path.dirname(__file__), 'rgb.png')]*5
+
+        images = dict(pool.images2d(filenames))
+        self.assertEqual(sorted(images.keys()), list(range(5)))
+        for image in images.values():
+            self.assertEqual(image.size, Vector2i(3, 2))
+
+    def test_scenes(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter', thread_count=2)
+        filenames = [os.path.join(os.path.dirname(__file__), 'scene.gltf')]*3
+
+        scenes = dict(pool.scenes(filenames))
+        self.assertEqual(sorted(scenes.keys()), list(range(3)))
+        for scene in scenes.values():
+            self.assertEqual(scene.mapping_bound, 4)
+
+    def test_failed(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter', thread_count=2)
+
+        # Mesh 2 in mesh.gltf is broken
+        with self.assertRaisesRegex(RuntimeError, "importing .*mesh.gltf failed"):
+            list(pool.meshes([os.path.join(os.path.dirname(__file__), 'mesh.gltf')], id=2))
+
+        # Out-of-range IDs and nonexistent files fail the same way
+        with self.assertRaisesRegex(RuntimeError, "importing .*two-meshes.gltf failed"):
+            list(pool.meshes([os.path.join(os.path.dirname(__file__), 'two-meshes.gltf')], id=2))
+        with self.assertRaisesRegex(RuntimeError, "importing nonexistent.gltf failed"):
+            list(pool.meshes(['nonexistent.gltf']))
+
+    def test_already_importing(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter', thread_count=2)
+        filenames = [os.path.join(os.path.dirname(__file__), 'mesh.gltf')]*4
+
+        it = pool.meshes(filenames)
+        with self.assertRaisesRegex(RuntimeError, "the pool is already importing"):
+            pool.meshes(filenames)
+        with self.assertRaisesRegex(RuntimeError, "the pool is importing"):
+            pool.close()
+
+        # Destroying the iterator without exhausting it makes the pool
+        # available again
+        next(it)
+        del it
+        self.assertEqual(len(list(pool.meshes(filenames))), 4)
+
+    def test_closed(self):
+        pool = trade.ImportPool(trade.ImporterManager(), 'GltfImporter')
+        pool.close()
+
+        with self.assertRaisesRegex(AssertionError, "the pool is closed"):
+            pool.meshes([])
+
 class ImageConverter(unittest.TestCase):
     def test(self):
         converter = trade.ImageConverterManager().load_and_instantiate('StbImageConverter')
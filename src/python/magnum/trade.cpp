@@ -24,15 +24,32 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h> /* for std::vector */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringStl.h> /** @todo drop once we have our string casters */
 #include <Corrade/Containers/Triple.h>
+#include <Corrade/PluginManager/PluginMetadata.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
+#include <Magnum/FileCallback.h>
 #include <Magnum/ImageView.h>
 #include <Magnum/Math/Complex.h>
+#include <Magnum/Math/CubicHermite.h>
 #include <Magnum/Math/DualComplex.h>
+#include <Magnum/Math/Functions.h>
 #include <Magnum/Math/Matrix4.h>
 #include <Magnum/Math/Packing.h>
 #include <Magnum/Math/Quaternion.h>
@@ -41,12 +58,14 @@
 #include <Magnum/Trade/AbstractImporter.h>
 #include <Magnum/Trade/AbstractImageConverter.h>
 #include <Magnum/Trade/AbstractSceneConverter.h>
+#include <Magnum/Trade/AnimationData.h>
 #include <Magnum/Trade/ImageData.h>
 #include <Magnum/Trade/MaterialData.h>
 #include <Magnum/Trade/MeshData.h>
 #include <Magnum/Trade/SceneData.h>
 #include <Magnum/Trade/TextureData.h>
 
+#include "Corrade/Containers/ArrayPythonBindings.h"
 #include "Corrade/Containers/PythonBindings.h"
 #include "Corrade/Containers/OptionalPythonBindings.h"
 #include "Magnum/PythonBindings.h"
@@ -58,13 +77,6 @@
 #include "magnum/acessorsForPixelFormat.h"
 #include "magnum/bootstrap.h"
 
-#ifdef CORRADE_TARGET_WINDOWS
-/* To allow people to conveniently use Python's os.path, we need to convert
-   backslashes to forward slashes as all Corrade and Magnum APIs expect
-   forward */
-#include <Corrade/Utility/Path.h>
-#endif
-
 namespace magnum {
 
 namespace {
@@ -172,6 +184,204 @@ template<class T, typename std::underlying_type<T>::type baseCustomValue> void e
         py::is_method(enum_));
 }
 
+/* Data of MeshData, ImageData and SceneData are pickled as PickleBuffer
+   instances, which with pickle protocol 5 allows them to be transferred
+   out-of-band with no copies. With older protocols they get serialized as
+   bytes, or bytearray if the data are mutable. */
+template<class T> py::object pickleData(const Containers::ArrayView<T> data, py::object owner) {
+    #if PY_VERSION_HEX >= 0x03080000
+    return py::module_::import("pickle").attr("PickleBuffer")(pyCastButNotShitty(Containers::pyArrayViewHolder(data, data ? std::move(owner) : py::none{})));
+    #else
+    static_cast<void>(owner);
+    return py::bytes(data.data(), data.size());
+    #endif
+}
+
+/* The inverse of the above. The data reference the memory of whatever buffer
+   pickle passes back, which is then used as the owner. If the buffer is
+   writable, the data are marked as mutable. Used also for constructing
+   MeshData directly from Python buffers without a copy. */
+Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> bufferData(py::handle object) {
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    Trade::DataFlags flags = Trade::DataFlag::Mutable;
+    if(PyObject_GetBuffer(object.ptr(), &buffer, PyBUF_WRITABLE) != 0) {
+        PyErr_Clear();
+        flags = {};
+        if(PyObject_GetBuffer(object.ptr(), &buffer, PyBUF_SIMPLE) != 0)
+            throw py::error_already_set{};
+    }
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    /* Same as in the ArrayView buffer constructor, taking the underlying
+       object instead of the buffer descriptor */
+    return {Containers::ArrayView<const void>{buffer.buf, std::size_t(buffer.len)}, flags, buffer.len ? py::reinterpret_borrow<py::object>(buffer.obj) : py::none{}};
+}
+
+void checkPickleState(const py::tuple& state, const std::size_t expected) {
+    if(state.size() != expected) {
+        PyErr_Format(PyExc_ValueError, "expected a tuple with %zu elements but got %zu", expected, state.size());
+        throw py::error_already_set{};
+    }
+}
+
+py::tuple meshDataGetState(Trade::MeshData& self) {
+    py::list attributes;
+    for(UnsignedInt i = 0; i != self.attributeCount(); ++i)
+        attributes.append(py::make_tuple(
+            UnsignedShort(self.attributeName(i)),
+            UnsignedInt(self.attributeFormat(i)),
+            self.attributeOffset(i),
+            self.attributeStride(i),
+            self.attributeArraySize(i),
+            self.attributeMorphTargetId(i)));
+
+    const py::object indices = self.isIndexed() ?
+        py::make_tuple(UnsignedInt(self.indexType()), self.indexOffset(), self.indexCount(), self.indexStride()) :
+        py::none{};
+    const py::object meshObject = py::cast(self);
+    return py::make_tuple(
+        UnsignedInt(self.primitive()),
+        self.vertexCount(),
+        indices,
+        self.indexDataFlags() & Trade::DataFlag::Mutable ?
+            pickleData(self.mutableIndexData(), meshObject) :
+            pickleData(self.indexData(), meshObject),
+        self.vertexDataFlags() & Trade::DataFlag::Mutable ?
+            pickleData(self.mutableVertexData(), meshObject) :
+            pickleData(self.vertexData(), meshObject),
+        attributes);
+}
+
+Trade::PyDataHolder<Trade::MeshData> meshDataSetState(const py::tuple& state) {
+    checkPickleState(state, 6);
+
+    const Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> indexData = bufferData(state[3]);
+    const Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> vertexData = bufferData(state[4]);
+
+    const py::list attributeStates = py::cast<py::list>(state[5]);
+    Containers::Array<Trade::MeshAttributeData> attributes{NoInit, std::size_t(attributeStates.size())};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const py::tuple attribute = py::cast<py::tuple>(attributeStates[i]);
+        checkPickleState(attribute, 6);
+        /* Offset-only attributes, the MeshData constructor checks that they
+           fit into the vertex data */
+        new(&attributes[i]) Trade::MeshAttributeData{
+            Trade::MeshAttribute(py::cast<UnsignedShort>(attribute[0])),
+            VertexFormat(py::cast<UnsignedInt>(attribute[1])),
+            py::cast<std::size_t>(attribute[2]),
+            py::cast<UnsignedInt>(state[1]),
+            py::cast<std::ptrdiff_t>(attribute[3]),
+            py::cast<UnsignedShort>(attribute[4]),
+            py::cast<Int>(attribute[5])};
+    }
+
+    Trade::MeshIndexData indices;
+    if(!state[2].is_none()) {
+        const py::tuple index = py::cast<py::tuple>(state[2]);
+        checkPickleState(index, 4);
+        indices = Trade::MeshIndexData{
+            MeshIndexType(py::cast<UnsignedInt>(index[0])),
+            Containers::StridedArrayView1D<const void>{indexData.first(),
+                static_cast<const char*>(indexData.first().data()) + py::cast<std::size_t>(index[1]),
+                py::cast<std::size_t>(index[2]),
+                py::cast<std::ptrdiff_t>(index[3])}};
+    }
+
+    /* Keep both buffers alive if there are two */
+    py::object owner;
+    if(indexData.third().is_none())
+        owner = vertexData.third();
+    else if(vertexData.third().is_none())
+        owner = indexData.third();
+    else
+        owner = py::make_tuple(indexData.third(), vertexData.third());
+
+    return Trade::pyDataHolder(Trade::MeshData{MeshPrimitive(py::cast<UnsignedInt>(state[0])),
+        indexData.second(), indexData.first(), indices,
+        vertexData.second(), vertexData.first(), std::move(attributes),
+        py::cast<UnsignedInt>(state[1])}, std::move(owner));
+}
+
+py::tuple sceneDataGetState(Trade::SceneData& self) {
+    /* All fields are saved as offset-only, relative to the data array, which
+       the SceneData constructor requires them to be contained in */
+    const char* const data = static_cast<const char*>(self.data().data());
+    py::list fields;
+    for(UnsignedInt i = 0; i != self.fieldCount(); ++i) {
+        const Trade::SceneFieldData field = self.fieldData(i);
+        std::size_t fieldOffset, fieldBitOffset = 0, stringOffset = 0;
+        std::ptrdiff_t fieldStride;
+        if(field.fieldType() == Trade::SceneFieldType::Bit) {
+            const Containers::StridedBitArrayView2D fieldBitData = field.fieldBitData();
+            fieldOffset = static_cast<const char*>(fieldBitData.data()) - data;
+            fieldBitOffset = fieldBitData.offset();
+            fieldStride = fieldBitData.stride()[0];
+        } else {
+            fieldOffset = static_cast<const char*>(field.fieldData().data()) - data;
+            fieldStride = field.fieldData().stride();
+            if(Trade::Implementation::isSceneFieldTypeString(field.fieldType()))
+                stringOffset = static_cast<const char*>(field.stringData()) - data;
+        }
+
+        fields.append(py::make_tuple(
+            UnsignedInt(field.name()),
+            field.size(),
+            std::size_t(static_cast<const char*>(field.mappingData().data()) - data),
+            field.mappingData().stride(),
+            UnsignedShort(field.fieldType()),
+            fieldOffset,
+            fieldBitOffset,
+            stringOffset,
+            fieldStride,
+            field.fieldArraySize(),
+            Containers::enumCastUnderlyingType(field.flags() & ~Trade::SceneFieldFlag::OffsetOnly)));
+    }
+
+    return py::make_tuple(
+        UnsignedByte(self.mappingType()),
+        self.mappingBound(),
+        self.dataFlags() & Trade::DataFlag::Mutable ?
+            pickleData(self.mutableData(), py::cast(self)) :
+            pickleData(self.data(), py::cast(self)),
+        fields);
+}
+
+Trade::PyDataHolder<Trade::SceneData> sceneDataSetState(const py::tuple& state) {
+    checkPickleState(state, 4);
+
+    const Trade::SceneMappingType mappingType = Trade::SceneMappingType(py::cast<UnsignedByte>(state[0]));
+    const Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> data = bufferData(state[2]);
+
+    const py::list fieldStates = py::cast<py::list>(state[3]);
+    Containers::Array<Trade::SceneFieldData> fields{NoInit, std::size_t(fieldStates.size())};
+    for(std::size_t i = 0; i != fields.size(); ++i) {
+        const py::tuple field = py::cast<py::tuple>(fieldStates[i]);
+        checkPickleState(field, 11);
+        const Trade::SceneField name = Trade::SceneField(py::cast<UnsignedInt>(field[0]));
+        const std::size_t size = py::cast<std::size_t>(field[1]);
+        const std::size_t mappingOffset = py::cast<std::size_t>(field[2]);
+        const std::ptrdiff_t mappingStride = py::cast<std::ptrdiff_t>(field[3]);
+        const Trade::SceneFieldType fieldType = Trade::SceneFieldType(py::cast<UnsignedShort>(field[4]));
+        const std::size_t fieldOffset = py::cast<std::size_t>(field[5]);
+        const std::ptrdiff_t fieldStride = py::cast<std::ptrdiff_t>(field[8]);
+        const UnsignedShort fieldArraySize = py::cast<UnsignedShort>(field[9]);
+        const Trade::SceneFieldFlags flags = Trade::SceneFieldFlag(py::cast<UnsignedByte>(field[10]));
+
+        /* The SceneData constructor checks that all fields fit into the
+           data */
+        if(fieldType == Trade::SceneFieldType::Bit)
+            new(&fields[i]) Trade::SceneFieldData{name, size, mappingType, mappingOffset, mappingStride, fieldOffset, py::cast<std::size_t>(field[6]), fieldStride, fieldArraySize, flags};
+        else if(Trade::Implementation::isSceneFieldTypeString(fieldType))
+            new(&fields[i]) Trade::SceneFieldData{name, size, mappingType, mappingOffset, mappingStride, py::cast<std::size_t>(field[7]), fieldType, fieldOffset, fieldStride, flags};
+        else
+            new(&fields[i]) Trade::SceneFieldData{name, size, mappingType, mappingOffset, mappingStride, fieldType, fieldOffset, fieldStride, fieldArraySize, flags};
+    }
+
+    return Trade::pyDataHolder(Trade::SceneData{mappingType, py::cast<UnsignedLong>(state[1]), data.second(), data.first(), std::move(fields)}, data.third());
+}
+
 template<UnsignedInt dimensions, class T> PyObject* implicitlyConvertibleToImageView(PyObject* obj, PyTypeObject*) {
     py::detail::make_caster<Trade::ImageData<dimensions>> caster;
     if(!caster.load(obj, false)) {
@@ -259,6 +469,55 @@ template<UnsignedInt dimensions> void imageData(py::class_<Trade::ImageData<dime
         /* There are no constructors at the moment --- expecting those types
            get only created by importers. (It would also need the Array type
            and movability figured out, postponing that to later.) */
+
+        /* Pickling */
+        .def(py::pickle(
+            [](Trade::ImageData<dimensions>& self) {
+                /** @todo compressed images, once CompressedPixelStorage is
+                    exposed */
+                if(self.isCompressed()) {
+                    PyErr_SetString(PyExc_NotImplementedError, "pickling compressed images is not implemented yet, sorry");
+                    throw py::error_already_set{};
+                }
+
+                /* Saving the raw format, extra format and pixel size to
+                   support implementation-specific formats as well */
+                const PixelStorage storage = self.storage();
+                return py::make_tuple(
+                    py::make_tuple(storage.alignment(), storage.rowLength(), storage.imageHeight(), storage.skip()),
+                    UnsignedInt(self.format()),
+                    self.formatExtra(),
+                    self.pixelSize(),
+                    PyDimensionTraits<dimensions, Int>::from(self.size()),
+                    Containers::enumCastUnderlyingType(self.flags()),
+                    self.dataFlags() & Trade::DataFlag::Mutable ?
+                        pickleData(self.mutableData(), py::cast(self)) :
+                        pickleData(self.data(), py::cast(self)));
+            },
+            [](const py::tuple& state) {
+                checkPickleState(state, 7);
+                const py::tuple storageState = py::cast<py::tuple>(state[0]);
+                checkPickleState(storageState, 4);
+                PixelStorage storage;
+                storage
+                    .setAlignment(py::cast<Int>(storageState[0]))
+                    .setRowLength(py::cast<Int>(storageState[1]))
+                    .setImageHeight(py::cast<Int>(storageState[2]))
+                    .setSkip(py::cast<Vector3i>(storageState[3]));
+
+                /* The ImageData constructor checks that the data are large
+                   enough */
+                const Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> data = bufferData(state[6]);
+                return Trade::pyDataHolder(Trade::ImageData<dimensions>{storage,
+                    PixelFormat(py::cast<UnsignedInt>(state[1])),
+                    py::cast<UnsignedInt>(state[2]),
+                    py::cast<UnsignedInt>(state[3]),
+                    py::cast<typename PyDimensionTraits<dimensions, Int>::VectorType>(state[4]),
+                    data.second(), data.first(),
+                    ImageFlags<dimensions>{typename ImageFlags<dimensions>::Type(py::cast<UnsignedShort>(state[5]))}}, data.third());
+            }
+        ))
+
         .def_property_readonly("data_flags", [](Trade::ImageData<dimensions>& self) {
             return Trade::DataFlag(Containers::enumCastUnderlyingType(self.dataFlags()));
         }, "Data flags")
@@ -334,10 +593,99 @@ template<UnsignedInt dimensions> void imageData(py::class_<Trade::ImageData<dime
         }, "Memory owner");
 }
 
+/* Importer APIs that can take a long time, such as opening a file or
+   importing data, are called with the GIL released so other Python threads
+   can run in the meantime, including ones that import through other importer
+   instances. The plugin instance itself isn't thread-safe, so it's marked as
+   busy for the duration of such a call and all importer bindings check the
+   flag to fail with an exception instead of racing on the same instance. */
+void checkNotBusy(Trade::AbstractImporter& self) {
+    if(pyObjectHolderFor<PluginManager::PyPluginHolder>(self).busy) {
+        PyErr_SetString(PyExc_RuntimeError, "importer is being used from another thread");
+        throw py::error_already_set{};
+    }
+}
+
+/* Has to be constructed before py::gil_scoped_release and thus destructed
+   after it, so the busy flag is only ever accessed with the GIL held */
+struct ImporterBusyScope {
+    explicit ImporterBusyScope(Trade::AbstractImporter& self): holder(pyObjectHolderFor<PluginManager::PyPluginHolder>(self)) {
+        CORRADE_INTERNAL_ASSERT(!holder.busy);
+        holder.busy = true;
+    }
+
+    ~ImporterBusyScope() {
+        holder.busy = false;
+    }
+
+    PluginManager::PyPluginHolder<Trade::AbstractImporter>& holder;
+};
+
+/* Data imported from a file opened with open_file(mmap=True) may reference
+   the mapped memory instead of owning a copy, in which case they get the
+   mapping as an owner. TextureData never reference any memory. */
+template<class T> struct ImporterData {
+    typedef Trade::PyDataHolder<T> Type;
+
+    static Type wrap(Trade::AbstractImporter& self, T&& data) {
+        PluginManager::PyPluginHolder<Trade::AbstractImporter>& holder = pyObjectHolderFor<PluginManager::PyPluginHolder>(self);
+        py::object owner = py::none{};
+        if(holder.memoryOwner && Trade::Implementation::pyDataFlagsNeedOwner(data))
+            owner = holder.memoryOwner;
+        return Trade::pyDataHolder(std::move(data), std::move(owner));
+    }
+};
+template<> struct ImporterData<Trade::TextureData> {
+    typedef Trade::TextureData Type;
+
+    static Type wrap(Trade::AbstractImporter&, Trade::TextureData&& data) {
+        return std::move(data);
+    }
+};
+
+/* Closes the importer and releases the memory it was opened on, if any */
+void importerClose(Trade::AbstractImporter& self) {
+    self.close();
+
+    PluginManager::PyPluginHolder<Trade::AbstractImporter>& holder = pyObjectHolderFor<PluginManager::PyPluginHolder>(self);
+    if(holder.memoryOwner) {
+        /* The file callback references the memory owner, reset it first */
+        self.setFileCallback(nullptr);
+        holder.memoryOwner = py::object{};
+    }
+}
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+/* A file mapped by open_file(mmap=True), together with files it references,
+   which are mapped through the file callback as well */
+struct ImporterFileMapping {
+    Containers::String directory;
+    Containers::Array<const char, Utility::Path::MapDeleter> file;
+    Containers::Array<Containers::Array<const char, Utility::Path::MapDeleter>> externalFiles;
+};
+
+Containers::Optional<Containers::ArrayView<const char>> importerFileMappingCallback(const std::string& filename, InputFileCallbackPolicy policy, void* userData) {
+    /* The mappings are released only once the importer is closed and all
+       data referencing them are gone, so there's nothing to do on close */
+    if(policy == InputFileCallbackPolicy::Close)
+        return {};
+
+    ImporterFileMapping& mapping = *static_cast<ImporterFileMapping*>(userData);
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> file = Utility::Path::mapRead(Utility::Path::join(mapping.directory, filename));
+    if(!file)
+        return {};
+
+    const Containers::ArrayView<const char> out = *file;
+    arrayAppend(mapping.externalFiles, *std::move(file));
+    return out;
+}
+#endif
+
 /* For some reason having ...Args as the second (and not last) template
    argument does not work. So I'm listing all variants here ... which are
    exactly two, in fact. */
 template<class R, R(Trade::AbstractImporter::*f)() const> R checkOpened(Trade::AbstractImporter& self) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -345,6 +693,7 @@ template<class R, R(Trade::AbstractImporter::*f)() const> R checkOpened(Trade::A
     return (self.*f)();
 }
 template<class R, class Arg1, R(Trade::AbstractImporter::*f)(Arg1)> R checkOpened(Trade::AbstractImporter& self, Arg1 arg1) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -353,6 +702,7 @@ template<class R, class Arg1, R(Trade::AbstractImporter::*f)(Arg1)> R checkOpene
 }
 /** @todo drop this in favor of our own string caster */
 template<class R, R(Trade::AbstractImporter::*f)(Containers::StringView)> R checkOpenedString(Trade::AbstractImporter& self, const std::string& arg1) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -361,6 +711,7 @@ template<class R, R(Trade::AbstractImporter::*f)(Containers::StringView)> R chec
 }
 
 template<class R, R(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R checkOpenedBounds(Trade::AbstractImporter& self, UnsignedInt id) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -375,6 +726,7 @@ template<class R, R(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade
 }
 /** @todo drop this in favor of our own string caster */
 template<class R, Containers::String(Trade::AbstractImporter::*f)(R), R(Trade::AbstractImporter::*bounds)() const> std::string checkOpenedBoundsReturnsString(Trade::AbstractImporter& self, R id) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -388,7 +740,8 @@ template<class R, Containers::String(Trade::AbstractImporter::*f)(R), R(Trade::A
     return (self.*f)(id);
 }
 
-template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R checkOpenedBoundsResult(Trade::AbstractImporter& self, UnsignedInt id) {
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> typename ImporterData<R>::Type checkOpenedBoundsResult(Trade::AbstractImporter& self, UnsignedInt id) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -401,16 +754,22 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
 
     /** @todo log redirection -- but we'd need assertions to not be part of
         that so when it dies, the user can still see why */
-    Containers::Optional<R> out = (self.*f)(id);
+    Containers::Optional<R> out;
+    {
+        ImporterBusyScope busy{self};
+        py::gil_scoped_release release;
+        out = (self.*f)(id);
+    }
     if(!out) {
         PyErr_SetString(PyExc_RuntimeError, "import failed");
         throw py::error_already_set{};
     }
 
-    return *std::move(out);
+    return ImporterData<R>::wrap(self, *std::move(out));
 }
 /** @todo drop std::string in favor of our own string caster */
-template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), Int(Trade::AbstractImporter::*indexForName)(Containers::StringView), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R checkOpenedBoundsResultString(Trade::AbstractImporter& self, const std::string& name) {
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), Int(Trade::AbstractImporter::*indexForName)(Containers::StringView), UnsignedInt(Trade::AbstractImporter::*bounds)() const> typename ImporterData<R>::Type checkOpenedBoundsResultString(Trade::AbstractImporter& self, const std::string& name) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -426,16 +785,22 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
 
     /** @todo log redirection -- but we'd need assertions to not be part of
         that so when it dies, the user can still see why */
-    Containers::Optional<R> out = (self.*f)(id);
+    Containers::Optional<R> out;
+    {
+        ImporterBusyScope busy{self};
+        py::gil_scoped_release release;
+        out = (self.*f)(id);
+    }
     if(!out) {
         PyErr_SetString(PyExc_RuntimeError, "import failed");
         throw py::error_already_set{};
     }
 
-    return *std::move(out);
+    return ImporterData<R>::wrap(self, *std::move(out));
 }
 
-template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt, UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const, UnsignedInt(Trade::AbstractImporter::*levelBounds)(UnsignedInt)> R checkOpenedBoundsResult(Trade::AbstractImporter& self, UnsignedInt id, UnsignedInt level) {
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt, UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const, UnsignedInt(Trade::AbstractImporter::*levelBounds)(UnsignedInt)> typename ImporterData<R>::Type checkOpenedBoundsResult(Trade::AbstractImporter& self, UnsignedInt id, UnsignedInt level) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -454,16 +819,22 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
 
     /** @todo log redirection -- but we'd need assertions to not be part of
         that so when it dies, the user can still see why */
-    Containers::Optional<R> out = (self.*f)(id, level);
+    Containers::Optional<R> out;
+    {
+        ImporterBusyScope busy{self};
+        py::gil_scoped_release release;
+        out = (self.*f)(id, level);
+    }
     if(!out) {
         PyErr_SetString(PyExc_RuntimeError, "import failed");
         throw py::error_already_set{};
     }
 
-    return *std::move(out);
+    return ImporterData<R>::wrap(self, *std::move(out));
 }
 /** @todo drop std::string in favor of our own string caster */
-template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt, UnsignedInt), Int(Trade::AbstractImporter::*indexForName)(Containers::StringView), UnsignedInt(Trade::AbstractImporter::*bounds)() const, UnsignedInt(Trade::AbstractImporter::*levelBounds)(UnsignedInt)> R checkOpenedBoundsResultString(Trade::AbstractImporter& self, const std::string& name, UnsignedInt level) {
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt, UnsignedInt), Int(Trade::AbstractImporter::*indexForName)(Containers::StringView), UnsignedInt(Trade::AbstractImporter::*bounds)() const, UnsignedInt(Trade::AbstractImporter::*levelBounds)(UnsignedInt)> typename ImporterData<R>::Type checkOpenedBoundsResultString(Trade::AbstractImporter& self, const std::string& name, UnsignedInt level) {
+    checkNotBusy(self);
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_AssertionError, "no file opened");
         throw py::error_already_set{};
@@ -485,13 +856,90 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
 
     /** @todo log redirection -- but we'd need assertions to not be part of
         that so when it dies, the user can still see why */
-    Containers::Optional<R> out = (self.*f)(id, level);
+    Containers::Optional<R> out;
+    {
+        ImporterBusyScope busy{self};
+        py::gil_scoped_release release;
+        out = (self.*f)(id, level);
+    }
     if(!out) {
         PyErr_SetString(PyExc_RuntimeError, "import failed");
         throw py::error_already_set{};
     }
 
-    return *std::move(out);
+    return ImporterData<R>::wrap(self, *std::move(out));
+}
+
+/* Bulk variants of the above, importing all listed IDs (or all IDs, if no
+   list is passed) in a single call to avoid the overhead of going through
+   pybind for each. The whole loop is done with the GIL released. */
+Containers::Array<UnsignedInt> checkOpenedBoundsIds(Trade::AbstractImporter& self, const Containers::Optional<std::vector<UnsignedInt>>& ids, UnsignedInt(Trade::AbstractImporter::*bounds)() const) {
+    checkNotBusy(self);
+    if(!self.isOpened()) {
+        PyErr_SetString(PyExc_AssertionError, "no file opened");
+        throw py::error_already_set{};
+    }
+
+    const UnsignedInt count = (self.*bounds)();
+
+    if(!ids) {
+        Containers::Array<UnsignedInt> out{NoInit, count};
+        for(UnsignedInt i = 0; i != count; ++i)
+            out[i] = i;
+        return out;
+    }
+
+    Containers::Array<UnsignedInt> out{NoInit, ids->size()};
+    for(std::size_t i = 0; i != ids->size(); ++i) {
+        const UnsignedInt id = (*ids)[i];
+        if(id >= count) {
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u entries", id, count);
+            throw py::error_already_set{};
+        }
+        out[i] = id;
+    }
+    return out;
+}
+
+template<class R, class F> py::list importResults(Trade::AbstractImporter& self, const Containers::ArrayView<const UnsignedInt> ids, F importOne) {
+    Containers::Array<Containers::Optional<R>> out{ids.size()};
+    std::size_t failed = ~std::size_t{};
+    {
+        ImporterBusyScope busy{self};
+        py::gil_scoped_release release;
+        /** @todo log redirection -- but we'd need assertions to not be part
+            of that so when it dies, the user can still see why */
+        for(std::size_t i = 0; i != ids.size(); ++i) {
+            if(!(out[i] = importOne(ids[i]))) {
+                failed = i;
+                break;
+            }
+        }
+    }
+    if(failed != ~std::size_t{}) {
+        PyErr_Format(PyExc_RuntimeError, "import of entry %u failed", ids[failed]);
+        throw py::error_already_set{};
+    }
+
+    py::list list;
+    for(Containers::Optional<R>& i: out)
+        list.append(py::cast(ImporterData<R>::wrap(self, *std::move(i))));
+    return list;
+}
+
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt, UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const, UnsignedInt(Trade::AbstractImporter::*levelBounds)(UnsignedInt)> py::list checkOpenedBoundsResults(Trade::AbstractImporter& self, const Containers::Optional<std::vector<UnsignedInt>>& ids, UnsignedInt level) {
+    const Containers::Array<UnsignedInt> idsToImport = checkOpenedBoundsIds(self, ids, bounds);
+    for(const UnsignedInt id: idsToImport) {
+        const UnsignedInt levelCount = (self.*levelBounds)(id);
+        if(level >= levelCount) {
+            PyErr_Format(PyExc_IndexError, "level %u out of range for %u entries", level, levelCount);
+            throw py::error_already_set{};
+        }
+    }
+
+    return importResults<R>(self, idsToImport, [&self, level](UnsignedInt id) {
+        return (self.*f)(id, level);
+    });
 }
 
 /* Can't be named just checkResult() because the AbstractSceneConverter
@@ -634,6 +1082,88 @@ Containers::Triple<const char*, py::object(*)(const char*), void(*)(char*, py::h
     CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
+/* The inverse of the above, matching the format string and item size of a
+   view passed from Python */
+Containers::Optional<MeshIndexType> meshIndexTypeForFormat(const Containers::StringView format, const std::size_t itemsize) {
+    for(const MeshIndexType type: {MeshIndexType::UnsignedByte,
+                                   MeshIndexType::UnsignedShort,
+                                   MeshIndexType::UnsignedInt})
+        if(format == accessorsForMeshIndexType(type).first() && itemsize == meshIndexTypeSize(type))
+            return type;
+    return {};
+}
+
+/* Whether all items of a strided view lie inside given memory, including the
+   case of zero and negative strides */
+bool isStridedViewContained(const Containers::ArrayView<const void> data, const Containers::StridedArrayView1D<const void>& view, const std::size_t itemsize) {
+    if(view.isEmpty()) return true;
+    const char* begin = static_cast<const char*>(view.data());
+    const char* end = begin + itemsize;
+    const std::ptrdiff_t extent = view.stride()*std::ptrdiff_t(view.size() - 1);
+    if(extent < 0) begin += extent;
+    else end += extent;
+    return begin >= static_cast<const char*>(data.data()) && end <= static_cast<const char*>(data.data()) + data.size();
+}
+
+/* Creates a MeshData referencing memory of Python buffers. The attributes and
+   indices are expected to point into the buffers, which are then kept alive
+   by the returned instance. */
+Trade::PyDataHolder<Trade::MeshData> meshDataFromBuffers(const MeshPrimitive primitive, const py::handle indexDataObject, const Containers::PyStridedArrayView<1, const char>* const indices, const py::handle vertexDataObject, const std::vector<Trade::MeshAttributeData>& attributes, const UnsignedInt vertexCount) {
+    Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> indexData{{}, {}, py::none{}};
+    Trade::MeshIndexData indexDataDescription;
+    if(indices) {
+        indexData = bufferData(indexDataObject);
+        const Containers::Optional<MeshIndexType> indexType = meshIndexTypeForFormat(indices->format ? Containers::StringView{indices->format} : Containers::StringView{"B"}, indices->itemsize);
+        if(!indexType) {
+            PyErr_Format(PyExc_AssertionError, "expected index data type to be B, H or I but got %s", indices->format ? indices->format.data() : "B");
+            throw py::error_already_set{};
+        }
+        if(indices->stride() < -32768 || indices->stride() > 32767) {
+            PyErr_Format(PyExc_AssertionError, "expected index stride to fit into 16 bits but got %zi", indices->stride());
+            throw py::error_already_set{};
+        }
+        if(!isStridedViewContained(indexData.first(), *indices, indices->itemsize)) {
+            PyErr_SetString(PyExc_AssertionError, "indices are not contained in passed index data");
+            throw py::error_already_set{};
+        }
+        indexDataDescription = Trade::MeshIndexData{*indexType, Containers::StridedArrayView1D<const void>{*indices}};
+    }
+
+    const Containers::Triple<Containers::ArrayView<const void>, Trade::DataFlags, py::object> vertexData = bufferData(vertexDataObject);
+    if(attributes.empty() && vertexCount == Trade::ImplicitVertexCount) {
+        PyErr_SetString(PyExc_AssertionError, "vertex count can't be implicit if there are no attributes");
+        throw py::error_already_set{};
+    }
+    const UnsignedInt expectedVertexCount = vertexCount == Trade::ImplicitVertexCount ? UnsignedInt(attributes[0].data().size()) : vertexCount;
+    Containers::Array<Trade::MeshAttributeData> attributeData{NoInit, attributes.size()};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const Trade::MeshAttributeData& attribute = attributes[i];
+        if(attribute.data().size() != expectedVertexCount) {
+            PyErr_Format(PyExc_AssertionError, "attribute %zu has %zu vertices but %u expected", i, attribute.data().size(), expectedVertexCount);
+            throw py::error_already_set{};
+        }
+        if(!isStridedViewContained(vertexData.first(), attribute.data(), vertexFormatSize(attribute.format())*(attribute.arraySize() ? attribute.arraySize() : 1))) {
+            PyErr_Format(PyExc_AssertionError, "attribute %zu is not contained in passed vertex data", i);
+            throw py::error_already_set{};
+        }
+        new(&attributeData[i]) Trade::MeshAttributeData{attribute};
+    }
+
+    /* Keep both buffers alive if there are two, same as when unpickling */
+    py::object owner;
+    if(indexData.third().is_none())
+        owner = vertexData.third();
+    else if(vertexData.third().is_none())
+        owner = indexData.third();
+    else
+        owner = py::make_tuple(indexData.third(), vertexData.third());
+
+    return Trade::pyDataHolder(Trade::MeshData{primitive,
+        indexData.second(), indexData.first(), indexDataDescription,
+        vertexData.second(), vertexData.first(), std::move(attributeData),
+        vertexCount}, std::move(owner));
+}
+
 Containers::Triple<const char*, py::object(*)(const char*), void(*)(char*, py::handle)> accessorsForVertexFormat(const VertexFormat format) {
     switch(format) {
         #define _c(format)                                                  \
@@ -749,6 +1279,18 @@ template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<1
     return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, T>{data.template transposed<0, 1>()[0], formatStringGetitemSetitem.first(), itemsize, formatStringGetitemSetitem.second(), formatStringGetitemSetitem.third()}, std::move(owner));
 }
 
+/* Array attributes are exposed as a 2D view with the second dimension being
+   the array elements */
+template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<2, T>> meshAttributeArrayView(const VertexFormat format, const Containers::StridedArrayView2D<T>& data, py::object owner) {
+    const std::size_t itemsize = vertexFormatSize(format);
+    const Containers::Triple<const char*, py::object(*)(const char*), void(*)(char*, py::handle)> formatStringGetitemSetitem = accessorsForVertexFormat(format);
+    if(!formatStringGetitemSetitem.first()) {
+        PyErr_Format(PyExc_NotImplementedError, "access to %S is not implemented yet, sorry", py::cast(format).ptr());
+        throw py::error_already_set{};
+    }
+    return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<2, T>{data.every({1, itemsize}), formatStringGetitemSetitem.first(), itemsize, formatStringGetitemSetitem.second(), formatStringGetitemSetitem.third()}, std::move(owner));
+}
+
 void sceneFieldDataConstructorChecks(const Trade::SceneField name, const Trade::SceneMappingType mappingType, const Containers::PyStridedArrayView<1, const char>& mappingData, const Trade::SceneFieldType fieldType, const std::size_t fieldDataSize, const std::ptrdiff_t fieldDataStride, const UnsignedShort fieldArraySize, const Trade::SceneFieldFlag flags) {
     if(mappingData.size() != fieldDataSize) {
         PyErr_Format(PyExc_AssertionError, "expected %S mapping and field view to have the same size but got %zu and %zu", py::cast(name).ptr(), mappingData.size(), fieldDataSize);
@@ -991,6 +1533,418 @@ template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<1
     return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, T>{data.template transposed<0, 1>()[0], formatStringGetitemSetitem.first(), itemsize, formatStringGetitemSetitem.second(), formatStringGetitemSetitem.third()}, std::move(owner));
 }
 
+/* Array fields are exposed as a 2D view with the second dimension being the
+   array elements, same as with meshAttributeArrayView() */
+template<class T> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<2, T>> sceneFieldArrayView(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<T>& data, py::object owner) {
+    const std::size_t itemsize = Trade::sceneFieldTypeSize(type);
+    const Containers::Triple<const char*, py::object(*)(const char*), void(*)(char*, py::handle)> formatStringGetitemSetitem = accessorsForSceneFieldType(type);
+    if(!formatStringGetitemSetitem.first()) {
+        PyErr_Format(PyExc_NotImplementedError, "access to %S is not implemented yet, sorry", py::cast(type).ptr());
+        throw py::error_already_set{};
+    }
+    return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<2, T>{data.every({1, itemsize}), formatStringGetitemSetitem.first(), itemsize, formatStringGetitemSetitem.second(), formatStringGetitemSetitem.third()}, std::move(owner));
+}
+
+/* Picks a 1D or 2D strided (bit) view based on the field type and array
+   size */
+py::object sceneFieldAnyView(Trade::SceneData& self, const UnsignedInt id, py::object owner) {
+    if(self.fieldArraySize(id) != 0) {
+        if(self.fieldType(id) == Trade::SceneFieldType::Bit)
+            return pyCastButNotShitty(Containers::pyArrayViewHolder(self.fieldBitArrays(id), std::move(owner)));
+        return pyCastButNotShitty(sceneFieldArrayView(self.fieldType(id), self.field(id), std::move(owner)));
+    }
+    if(self.fieldType(id) == Trade::SceneFieldType::Bit)
+        return pyCastButNotShitty(Containers::pyArrayViewHolder(self.fieldBits(id), std::move(owner)));
+    return pyCastButNotShitty(sceneFieldView(self.fieldType(id), self.field(id), std::move(owner)));
+}
+
+py::object sceneMutableFieldAnyView(Trade::SceneData& self, const UnsignedInt id, py::object owner) {
+    if(self.fieldArraySize(id) != 0) {
+        if(self.fieldType(id) == Trade::SceneFieldType::Bit)
+            return pyCastButNotShitty(Containers::pyArrayViewHolder(self.mutableFieldBitArrays(id), std::move(owner)));
+        return pyCastButNotShitty(sceneFieldArrayView(self.fieldType(id), self.mutableField(id), std::move(owner)));
+    }
+    if(self.fieldType(id) == Trade::SceneFieldType::Bit)
+        return pyCastButNotShitty(Containers::pyArrayViewHolder(self.mutableFieldBits(id), std::move(owner)));
+    return pyCastButNotShitty(sceneFieldView(self.fieldType(id), self.mutableField(id), std::move(owner)));
+}
+
+/* Typed track access asserts that both the value and the result type match,
+   so only the default result type is used here. Tracks with a different
+   result type, such as cubic Hermite splines, are rejected before. */
+template<class V> Containers::StridedArrayView1D<const V> animationTrackValues(const Trade::AnimationData& data, const UnsignedInt id) {
+    return data.track<V>(id).values();
+}
+template<class V> Containers::StridedArrayView1D<V> animationTrackValues(Trade::AnimationData& data, const UnsignedInt id) {
+    return data.mutableTrack<V>(id).values();
+}
+
+template<class T, class Data> Containers::PyArrayViewHolder<Containers::PyStridedArrayView<1, T>> animationTrackValuesView(Data& data, const UnsignedInt id, py::object owner) {
+    const Trade::AnimationTrackType type = data.trackType(id);
+    const Trade::AnimationTrackType resultType = data.trackResultType(id);
+    if(type != resultType) {
+        PyErr_Format(PyExc_NotImplementedError, "access to %S tracks with %S results is not implemented yet, sorry", py::cast(type).ptr(), py::cast(resultType).ptr());
+        throw py::error_already_set{};
+    }
+
+    switch(type) {
+        #define _c(type) case Trade::AnimationTrackType::type:              \
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, T>{animationTrackValues<type>(data, id)}, std::move(owner));
+        /* LCOV_EXCL_START */
+        case Trade::AnimationTrackType::Bool:
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, T>{animationTrackValues<bool>(data, id), "?", sizeof(bool)}, std::move(owner));
+        _c(Float)
+        _c(UnsignedInt)
+        _c(Int)
+        _c(Vector2)
+        _c(Vector2ui)
+        _c(Vector2i)
+        _c(Vector3)
+        _c(Vector3ui)
+        _c(Vector3i)
+        _c(Vector4)
+        _c(Vector4ui)
+        _c(Vector4i)
+        _c(Complex)
+        _c(Quaternion)
+        _c(DualQuaternion)
+        /* LCOV_EXCL_STOP */
+        #undef _c
+
+        /** @todo handle these once BitVector and CubicHermite are exposed */
+        case Trade::AnimationTrackType::BitVector2:
+        case Trade::AnimationTrackType::BitVector3:
+        case Trade::AnimationTrackType::BitVector4:
+        case Trade::AnimationTrackType::CubicHermite1D:
+        case Trade::AnimationTrackType::CubicHermite2D:
+        case Trade::AnimationTrackType::CubicHermite3D:
+        case Trade::AnimationTrackType::CubicHermiteComplex:
+        case Trade::AnimationTrackType::CubicHermiteQuaternion:
+            PyErr_Format(PyExc_NotImplementedError, "access to %S is not implemented yet, sorry", py::cast(type).ptr());
+            throw py::error_already_set{};
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Evaluates a track at given times, writing result components to the second
+   dimension of the output. Called with the GIL released, so nothing
+   Python-related can happen inside. */
+typedef void(*AnimationTrackSampler)(const Trade::AnimationData&, UnsignedInt, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView2D<Float>&);
+
+template<class V, class R> void sampleAnimationTrack(const Trade::AnimationData& data, const UnsignedInt id, const Containers::StridedArrayView1D<const Float>& times, const Containers::StridedArrayView2D<Float>& out) {
+    const Animation::TrackView<const Float, const V, R>& track = data.track<V, R>(id);
+    /* With monotonic times the hint makes the keyframe lookup O(1) */
+    std::size_t hint = 0;
+    for(std::size_t i = 0; i != times.size(); ++i) {
+        const R value = track.at(times[i], hint);
+        const Float* const components = reinterpret_cast<const Float*>(&value);
+        for(std::size_t j = 0; j != sizeof(R)/sizeof(Float); ++j)
+            out[i][j] = components[j];
+    }
+}
+
+/* Returns the count of result components together with a sampler for given
+   track. Only float-based types are handled, as those are what imported
+   animations contain. */
+Containers::Pair<UnsignedInt, AnimationTrackSampler> animationTrackSampler(const Trade::AnimationData& data, const UnsignedInt id) {
+    const Trade::AnimationTrackType type = data.trackType(id);
+    const Trade::AnimationTrackType resultType = data.trackResultType(id);
+    #define _c(type_, resultType_)                                          \
+        if(type == Trade::AnimationTrackType::type_ && resultType == Trade::AnimationTrackType::resultType_) \
+            return {UnsignedInt(sizeof(resultType_)/sizeof(Float)), sampleAnimationTrack<type_, resultType_>};
+    _c(Float, Float)
+    _c(Vector2, Vector2)
+    _c(Vector3, Vector3)
+    _c(Vector4, Vector4)
+    _c(Complex, Complex)
+    _c(Quaternion, Quaternion)
+    _c(CubicHermite1D, Float)
+    _c(CubicHermite2D, Vector2)
+    _c(CubicHermite3D, Vector3)
+    _c(CubicHermiteComplex, Complex)
+    _c(CubicHermiteQuaternion, Quaternion)
+    #undef _c
+
+    PyErr_Format(PyExc_NotImplementedError, "sampling %S tracks with %S results is not implemented yet, sorry", py::cast(type).ptr(), py::cast(resultType).ptr());
+    throw py::error_already_set{};
+}
+
+/* Checks track IDs and picks a sampler for each. All tracks are expected to
+   have the same number of result components so they can be put into a single
+   output array. */
+Containers::Array<AnimationTrackSampler> animationTrackSamplers(const Trade::AnimationData& data, const std::vector<UnsignedInt>& ids, UnsignedInt& components) {
+    Containers::Array<AnimationTrackSampler> samplers{NoInit, ids.size()};
+    components = 0;
+    for(std::size_t i = 0; i != ids.size(); ++i) {
+        if(ids[i] >= data.trackCount()) {
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", ids[i], data.trackCount());
+            throw py::error_already_set{};
+        }
+
+        const Containers::Pair<UnsignedInt, AnimationTrackSampler> sampler = animationTrackSampler(data, ids[i]);
+        if(i && sampler.first() != components) {
+            PyErr_Format(PyExc_AssertionError, "expected track %u to have %u result components like track %u, got %u", ids[i], components, ids[0], sampler.first());
+            throw py::error_already_set{};
+        }
+        components = sampler.first();
+        samplers[i] = sampler.second();
+    }
+
+    return samplers;
+}
+
+Containers::StridedArrayView1D<const Float> animationSampleTimes(const Containers::PyStridedArrayView<1, const char>& times) {
+    if(times.itemsize != sizeof(Float) || Containers::StringView{times.format} != Containers::StringView{"f"}) {
+        PyErr_Format(PyExc_AssertionError, "expected times to be a view of 32-bit floats, got %s", times.format ? times.format.data() : "B");
+        throw py::error_already_set{};
+    }
+
+    return Containers::arrayCast<const Float>(times);
+}
+
+void sampleAnimationTracks(const Trade::AnimationData& data, const std::vector<UnsignedInt>& ids, const Containers::ArrayView<const AnimationTrackSampler> samplers, const Containers::StridedArrayView1D<const Float>& times, const Containers::StridedArrayView3D<Float>& out) {
+    py::gil_scoped_release release;
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        samplers[i](data, ids[i], times, out[i]);
+}
+
+/* A set of importer instances, each used exclusively by one worker thread.
+   Neither the plugin manager nor the importers are thread-safe and importers
+   such as AnySceneImporter or GltfImporter load other plugins through their
+   manager, so each worker gets a dedicated manager as well. */
+struct ImportPool {
+    /* Importers have to be destroyed before their managers, so they're
+       declared after */
+    Containers::Array<Containers::Pointer<PluginManager::Manager<Trade::AbstractImporter>>> managers;
+    Containers::Array<Containers::Pointer<Trade::AbstractImporter>> importers;
+    /* Set while an iterator is running the import. Only ever accessed with
+       the GIL held. */
+    bool busy{};
+};
+
+/* Replicates state of the passed manager in a worker manager that uses the
+   same plugin directory. Plugins loaded from a file path outside of the
+   plugin directory can't be replicated as the manager doesn't expose the
+   path, the caller checks that the requested plugin isn't one of them. */
+void importPoolSetupManager(PluginManager::Manager<Trade::AbstractImporter>& manager, PluginManager::Manager<Trade::AbstractImporter>& worker) {
+    /* Preferred plugins. There's no getter for those, but an alias resolves
+       to the plugin it's redirected to. */
+    for(const Containers::StringView alias: manager.aliasList()) {
+        const Containers::StringView name = manager.metadata(alias)->name();
+        const PluginManager::PluginMetadata* const metadata = worker.metadata(name);
+        if(!metadata) continue;
+        bool providesAlias = false;
+        for(const Containers::StringView provides: metadata->provides()) {
+            if(provides == alias) {
+                providesAlias = true;
+                break;
+            }
+        }
+        if(providesAlias && worker.metadata(alias)->name() != name)
+            worker.setPreferredPlugins(alias, {name});
+    }
+
+    /* Initial plugin-specific configuration */
+    for(const Containers::StringView name: manager.pluginList()) {
+        if(PluginManager::PluginMetadata* const metadata = worker.metadata(name))
+            metadata->configuration() = manager.metadata(name)->configuration();
+    }
+}
+
+ImportPool* createImportPool(PluginManager::Manager<Trade::AbstractImporter>& manager, const std::string& plugin, UnsignedInt threadCount) {
+    if(!threadCount)
+        threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+
+    /* A plugin passed as a file path gets loaded from that path by each
+       worker. Otherwise the workers have to resolve the name to the same
+       plugin as the passed manager would. */
+    const bool isPath = Containers::StringView{plugin}.hasSuffix(Trade::AbstractImporter::pluginSuffix());
+    const PluginManager::PluginMetadata* const metadata = isPath ? nullptr : manager.metadata(plugin);
+
+    Containers::Pointer<ImportPool> pool{InPlaceInit};
+    pool->managers = Containers::Array<Containers::Pointer<PluginManager::Manager<Trade::AbstractImporter>>>(threadCount);
+    pool->importers = Containers::Array<Containers::Pointer<Trade::AbstractImporter>>(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i) {
+        pool->managers[i].emplace(manager.pluginDirectory());
+        importPoolSetupManager(manager, *pool->managers[i]);
+
+        if(metadata) {
+            const PluginManager::PluginMetadata* const workerMetadata = pool->managers[i]->metadata(plugin);
+            if(!workerMetadata || workerMetadata->name() != metadata->name()) {
+                PyErr_Format(PyExc_RuntimeError, "plugin %s resolves to %s, which isn't found in the plugin directory, pass its file path instead", plugin.data(), std::string{metadata->name()}.data());
+                throw py::error_already_set{};
+            }
+        }
+
+        pool->importers[i] = pool->managers[i]->loadAndInstantiate(plugin);
+        if(!pool->importers[i]) {
+            PyErr_Format(PyExc_RuntimeError, "can't load and instantiate plugin %s", plugin.data());
+            throw py::error_already_set{};
+        }
+    }
+
+    return pool.release();
+}
+
+/* Import functions used by the pool workers. Checking the ID and level
+   bounds here, as the C++ APIs would assert otherwise. */
+Containers::Optional<Trade::MeshData> importPoolMesh(Trade::AbstractImporter& importer, const UnsignedInt id, const UnsignedInt level) {
+    if(id >= importer.meshCount() || level >= importer.meshLevelCount(id))
+        return {};
+    return importer.mesh(id, level);
+}
+
+Containers::Optional<Trade::ImageData2D> importPoolImage2D(Trade::AbstractImporter& importer, const UnsignedInt id, const UnsignedInt level) {
+    if(id >= importer.image2DCount() || level >= importer.image2DLevelCount(id))
+        return {};
+    return importer.image2D(id, level);
+}
+
+Containers::Optional<Trade::SceneData> importPoolScene(Trade::AbstractImporter& importer, const UnsignedInt id, UnsignedInt) {
+    if(id >= importer.sceneCount())
+        return {};
+    return importer.scene(id);
+}
+
+/* Distributes the files over worker threads and hands out the results in
+   the order in which they got imported */
+template<class T> struct ImportPoolIterator {
+    explicit ImportPoolIterator(py::object poolObject, ImportPool& pool, std::vector<std::string>&& filenames, Containers::Optional<T>(*importFunction)(Trade::AbstractImporter&, UnsignedInt, UnsignedInt), UnsignedInt id, UnsignedInt level): poolObject{std::move(poolObject)}, pool(pool), filenames{std::move(filenames)}, importFunction{importFunction}, id{id}, level{level}, results(this->filenames.size()), completed{NoInit, this->filenames.size()} {
+        #ifdef CORRADE_TARGET_WINDOWS
+        for(std::string& filename: this->filenames)
+            filename = Utility::Path::fromNativeSeparators(filename);
+        #endif
+
+        CORRADE_INTERNAL_ASSERT(!pool.busy);
+        pool.busy = true;
+
+        /* No point in spawning more threads than there are files. If
+           spawning a thread fails, join the already started ones and make
+           the pool available again, as the destructor isn't called. */
+        threads = Containers::Array<std::thread>(Math::min(pool.importers.size(), this->filenames.size()));
+        try {
+            for(std::size_t i = 0; i != threads.size(); ++i)
+                threads[i] = std::thread{&ImportPoolIterator<T>::work, this, std::ref(*pool.importers[i])};
+        } catch(...) {
+            finish();
+            throw;
+        }
+    }
+
+    ~ImportPoolIterator() { finish(); }
+
+    void work(Trade::AbstractImporter& importer) {
+        for(;;) {
+            std::size_t i;
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                if(cancelled || next == filenames.size()) return;
+                i = next++;
+            }
+
+            /* A failure leaves the result empty, reported in __next__() */
+            Containers::Optional<T> out;
+            if(importer.openFile(filenames[i])) {
+                out = importFunction(importer, id, level);
+                importer.close();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                results[i] = std::move(out);
+                completed[completedCount++] = i;
+            }
+            condition.notify_one();
+        }
+    }
+
+    /* Called with the GIL held */
+    void finish() {
+        if(finished) return;
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            cancelled = true;
+        }
+        {
+            /* Threads that are still running finish the file they're
+               currently importing, don't block other Python threads while
+               waiting for them */
+            py::gil_scoped_release release;
+            for(std::thread& thread: threads)
+                if(thread.joinable()) thread.join();
+        }
+
+        pool.busy = false;
+        finished = true;
+    }
+
+    py::object poolObject;
+    ImportPool& pool;
+    std::vector<std::string> filenames;
+    Containers::Optional<T>(*importFunction)(Trade::AbstractImporter&, UnsignedInt, UnsignedInt);
+    UnsignedInt id, level;
+
+    /* All of these are guarded by the mutex */
+    Containers::Array<Containers::Optional<T>> results;
+    Containers::Array<std::size_t> completed;
+    std::size_t next{}, completedCount{};
+    bool cancelled{};
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    /* Accessed only from the Python side */
+    Containers::Array<std::thread> threads;
+    std::size_t returnedCount{};
+    bool finished{};
+};
+
+template<class T, Containers::Optional<T>(*importFunction)(Trade::AbstractImporter&, UnsignedInt, UnsignedInt)> ImportPoolIterator<T>* importPoolImport(ImportPool& self, std::vector<std::string> filenames, const UnsignedInt id, const UnsignedInt level) {
+    if(self.importers.isEmpty()) {
+        PyErr_SetString(PyExc_AssertionError, "the pool is closed");
+        throw py::error_already_set{};
+    }
+    if(self.busy) {
+        PyErr_SetString(PyExc_RuntimeError, "the pool is already importing");
+        throw py::error_already_set{};
+    }
+
+    return new ImportPoolIterator<T>{py::cast(self), self, std::move(filenames), importFunction, id, level};
+}
+
+template<class T> py::tuple importPoolIteratorNext(ImportPoolIterator<T>& self) {
+    if(self.returnedCount == self.filenames.size()) {
+        self.finish();
+        throw py::stop_iteration{};
+    }
+
+    std::size_t i;
+    {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock{self.mutex};
+        self.condition.wait(lock, [&self]{
+            return self.completedCount > self.returnedCount;
+        });
+        i = self.completed[self.returnedCount++];
+    }
+
+    if(!self.results[i]) {
+        PyErr_Format(PyExc_RuntimeError, "importing %s failed", self.filenames[i].data());
+        throw py::error_already_set{};
+    }
+
+    return py::make_tuple(i, *std::move(self.results[i]));
+}
+
+template<class T> void importPoolIterator(py::class_<ImportPoolIterator<T>>& c) {
+    c
+        .def("__iter__", [](py::object& self) {
+            return self;
+        }, "Iterate")
+        .def("__next__", importPoolIteratorNext<T>, "Next imported file");
+}
+
 }
 
 void trade(py::module_& m) {
@@ -1085,6 +2039,24 @@ void trade(py::module_& m) {
         .def(py::init([](MeshPrimitive primitive, UnsignedInt vertexCount) {
             return Trade::MeshData{primitive, vertexCount};
         }), "Construct an index-less attribute-less mesh data", py::arg("primitive"), py::arg("vertex_count"))
+        .def(py::init([](MeshPrimitive primitive, const py::buffer& indexData, const Containers::PyStridedArrayView<1, const char>& indices, const py::buffer& vertexData, const std::vector<Trade::MeshAttributeData>& attributes, UnsignedInt vertexCount) {
+            return meshDataFromBuffers(primitive, indexData, &indices, vertexData, attributes, vertexCount);
+        }), "Construct an indexed mesh data referencing external buffers", py::arg("primitive"), py::arg("index_data"), py::arg("indices"), py::arg("vertex_data"), py::arg("attributes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("vertex_count") = Trade::ImplicitVertexCount)
+        .def(py::init([](MeshPrimitive primitive, const py::buffer& vertexData, const std::vector<Trade::MeshAttributeData>& attributes, UnsignedInt vertexCount) {
+            return meshDataFromBuffers(primitive, py::none{}, nullptr, vertexData, attributes, vertexCount);
+        }), "Construct a non-indexed mesh data referencing an external buffer", py::arg("primitive"), py::arg("vertex_data"), py::arg("attributes"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("vertex_count") = Trade::ImplicitVertexCount)
+
+        /* Pickling */
+        .def(py::pickle(meshDataGetState, meshDataSetState))
+
         .def_property_readonly("primitive", &Trade::MeshData::primitive, "Primitive")
         .def_property_readonly("index_data_flags", [](const Trade::MeshData& self) {
             return Trade::DataFlag(Containers::enumCastUnderlyingType(self.indexDataFlags()));
@@ -1307,13 +2279,10 @@ void trade(py::module_& m) {
         }, "Attribute array size", py::arg("id"))
         .def("attribute", [](/*const*/ Trade::MeshData& self, Trade::MeshAttribute name, UnsignedInt id, Int morphTargetId) {
             if(const Containers::Optional<UnsignedInt> found = self.findAttributeId(name, id, morphTargetId)) {
-                /** @todo handle arrays (return a 2D view, and especially
-                    annotate the return type properly in the docs) */
-                if(self.attributeArraySize(*found) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array attributes not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                return meshAttributeView(self.attributeFormat(*found), self.attribute(*found), py::cast(self));
+                /** @todo annotate the return type properly in the docs */
+                if(self.attributeArraySize(*found) != 0)
+                    return pyCastButNotShitty(meshAttributeArrayView(self.attributeFormat(*found), self.attribute(*found), py::cast(self)));
+                return pyCastButNotShitty(meshAttributeView(self.attributeFormat(*found), self.attribute(*found), py::cast(self)));
             }
 
             const UnsignedInt attributeCount = self.attributeCount(name, morphTargetId);
@@ -1329,13 +2298,10 @@ void trade(py::module_& m) {
             py::arg("id") = 0, py::arg("morph_target_id") = -1)
         .def("attribute", [](/*const*/ Trade::MeshData& self, UnsignedInt id) {
             if(id < self.attributeCount()) {
-                /** @todo handle arrays (return a 2D view, and especially
-                    annotate the return type properly in the docs) */
-                if(self.attributeArraySize(id) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array attributes not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                return meshAttributeView(self.attributeFormat(id), self.attribute(id), py::cast(self));
+                /** @todo annotate the return type properly in the docs */
+                if(self.attributeArraySize(id) != 0)
+                    return pyCastButNotShitty(meshAttributeArrayView(self.attributeFormat(id), self.attribute(id), py::cast(self)));
+                return pyCastButNotShitty(meshAttributeView(self.attributeFormat(id), self.attribute(id), py::cast(self)));
             }
 
             PyErr_Format(PyExc_IndexError, "index %u out of range for %u attributes", id, self.attributeCount());
@@ -1348,13 +2314,10 @@ void trade(py::module_& m) {
             }
 
             if(const Containers::Optional<UnsignedInt> found = self.findAttributeId(name, id, morphTargetId)) {
-                /** @todo handle arrays (return a 2D view, and especially
-                    annotate the return type properly in the docs) */
-                if(self.attributeArraySize(*found) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array attributes not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                return meshAttributeView(self.attributeFormat(*found), self.mutableAttribute(*found), py::cast(self));
+                /** @todo annotate the return type properly in the docs */
+                if(self.attributeArraySize(*found) != 0)
+                    return pyCastButNotShitty(meshAttributeArrayView(self.attributeFormat(*found), self.mutableAttribute(*found), py::cast(self)));
+                return pyCastButNotShitty(meshAttributeView(self.attributeFormat(*found), self.mutableAttribute(*found), py::cast(self)));
             }
 
             const UnsignedInt attributeCount = self.attributeCount(name, morphTargetId);
@@ -1375,13 +2338,10 @@ void trade(py::module_& m) {
             }
 
             if(id < self.attributeCount()) {
-                /** @todo handle arrays (return a 2D view, and especially
-                    annotate the return type properly in the docs) */
-                if(self.attributeArraySize(id) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array attributes not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
-                return meshAttributeView(self.attributeFormat(id), self.mutableAttribute(id), py::cast(self));
+                /** @todo annotate the return type properly in the docs */
+                if(self.attributeArraySize(id) != 0)
+                    return pyCastButNotShitty(meshAttributeArrayView(self.attributeFormat(id), self.mutableAttribute(id), py::cast(self)));
+                return pyCastButNotShitty(meshAttributeView(self.attributeFormat(id), self.mutableAttribute(id), py::cast(self)));
             }
 
             PyErr_Format(PyExc_IndexError, "index %u out of range for %u attributes", id, self.attributeCount());
@@ -2697,6 +3657,9 @@ void trade(py::module_& m) {
         }, "Field memory owner");
 
     py::class_<Trade::SceneData, Trade::PyDataHolder<Trade::SceneData>>{m, "SceneData", "Scene data"}
+        /* Pickling */
+        .def(py::pickle(sceneDataGetState, sceneDataSetState))
+
         .def_property_readonly("data_flags", [](const Trade::SceneData& self) {
             return Trade::DataFlag(Containers::enumCastUnderlyingType(self.dataFlags()));
         }, "Data flags")
@@ -2886,15 +3849,8 @@ void trade(py::module_& m) {
         }, "Mutable object mapping data for given field", py::arg("id"))
         .def("field", [](/*const*/ Trade::SceneData& self, Trade::SceneField name) {
             if(const Containers::Optional<UnsignedInt> found = self.findFieldId(name)) {
-                /** @todo handle arrays (return a 2D (bit) view) */
-                if(self.fieldArraySize(*found) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array fields not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
                 /** @todo annotate the return type properly in the docs */
-                if(self.fieldType(*found) == Trade::SceneFieldType::Bit)
-                    return pyCastButNotShitty(Containers::pyArrayViewHolder(self.fieldBits(*found), py::cast(self)));
-                return pyCastButNotShitty(sceneFieldView(self.fieldType(*found), self.field(*found), py::cast(self)));
+                return sceneFieldAnyView(self, *found, py::cast(self));
             }
 
             PyErr_Format(PyExc_KeyError, "%S not found among %u fields", py::cast(name).ptr(), self.fieldCount());
@@ -2905,15 +3861,8 @@ void trade(py::module_& m) {
                 PyErr_Format(PyExc_IndexError, "index %u out of range for %u fields", id, self.fieldCount());
                 throw py::error_already_set{};
             }
-            /** @todo handle arrays (return a 2D (bit) view) */
-            if(self.fieldArraySize(id) != 0) {
-                PyErr_SetString(PyExc_NotImplementedError, "array fields not implemented yet, sorry");
-                throw py::error_already_set{};
-            }
             /** @todo annotate the return type properly in the docs */
-            if(self.fieldType(id) == Trade::SceneFieldType::Bit)
-                return pyCastButNotShitty(Containers::pyArrayViewHolder(self.fieldBits(id), py::cast(self)));
-            return pyCastButNotShitty(sceneFieldView(self.fieldType(id), self.field(id), py::cast(self)));
+            return sceneFieldAnyView(self, id, py::cast(self));
         }, "Data for given field", py::arg("id"))
         .def("mutable_field", [](Trade::SceneData& self, Trade::SceneField name) {
             if(!(self.dataFlags() & Trade::DataFlag::Mutable)) {
@@ -2921,15 +3870,8 @@ void trade(py::module_& m) {
                 throw py::error_already_set{};
             }
             if(const Containers::Optional<UnsignedInt> found = self.findFieldId(name)) {
-                /** @todo handle arrays (return a 2D (bit) view) */
-                if(self.fieldArraySize(*found) != 0) {
-                    PyErr_SetString(PyExc_NotImplementedError, "array fields not implemented yet, sorry");
-                    throw py::error_already_set{};
-                }
                 /** @todo annotate the return type properly in the docs */
-                if(self.fieldType(*found) == Trade::SceneFieldType::Bit)
-                    return pyCastButNotShitty(Containers::pyArrayViewHolder(self.mutableFieldBits(*found), py::cast(self)));
-                return pyCastButNotShitty(sceneFieldView(self.fieldType(*found), self.mutableField(*found), py::cast(self)));
+                return sceneMutableFieldAnyView(self, *found, py::cast(self));
             }
 
             PyErr_Format(PyExc_KeyError, "%S not found among %u fields", py::cast(name).ptr(), self.fieldCount());
@@ -2944,21 +3886,218 @@ void trade(py::module_& m) {
                 PyErr_SetString(PyExc_AttributeError, "scene data is not mutable");
                 throw py::error_already_set{};
             }
-            /** @todo handle arrays (return a 2D (bit) view) */
-            if(self.fieldArraySize(id) != 0) {
-                PyErr_SetString(PyExc_NotImplementedError, "array fields not implemented yet, sorry");
-                throw py::error_already_set{};
-            }
             /** @todo annotate the return type properly in the docs */
-            if(self.fieldType(id) == Trade::SceneFieldType::Bit)
-                return pyCastButNotShitty(Containers::pyArrayViewHolder(self.mutableFieldBits(id), py::cast(self)));
-            return pyCastButNotShitty(sceneFieldView(self.fieldType(id), self.mutableField(id), py::cast(self)));
+            return sceneMutableFieldAnyView(self, id, py::cast(self));
         }, "Mutable data for given field", py::arg("id"))
+        .def("fields_as_dict", [](Trade::SceneData& self) {
+            /* Casting self just once for all views */
+            const py::object owner = py::cast(self);
+            py::dict out;
+            for(UnsignedInt i = 0; i != self.fieldCount(); ++i) {
+                py::object field;
+                /* There's no view type for strings, so unlike field() which
+                   fails for them, they're converted to a list to make this
+                   usable for any scene */
+                if(Trade::Implementation::isSceneFieldTypeString(self.fieldType(i))) {
+                    const Containers::StringIterable strings = self.fieldStrings(i);
+                    py::list list{strings.size()};
+                    for(std::size_t j = 0; j != strings.size(); ++j) {
+                        const Containers::StringView string = strings[j];
+                        list[j] = py::str{string.data(), string.size()};
+                    }
+                    field = std::move(list);
+                } else field = sceneFieldAnyView(self, i, owner);
+
+                out[py::cast(self.fieldName(i))] = py::make_tuple(
+                    pyCastButNotShitty(sceneMappingView(self.mappingType(), self.mapping(i), owner)),
+                    std::move(field));
+            }
+            return out;
+        }, "Object mapping and data of all fields")
 
         .def_property_readonly("owner", [](Trade::SceneData& self) {
             return pyObjectHolderFor<Trade::PyDataHolder>(self).owner;
         }, "Memory owner");
 
+    py::enum_<Trade::AnimationTrackType>{m, "AnimationTrackType", "Type of animation track data"}
+        .value("BOOL", Trade::AnimationTrackType::Bool)
+        .value("FLOAT", Trade::AnimationTrackType::Float)
+        .value("UNSIGNED_INT", Trade::AnimationTrackType::UnsignedInt)
+        .value("INT", Trade::AnimationTrackType::Int)
+        .value("BIT_VECTOR2", Trade::AnimationTrackType::BitVector2)
+        .value("BIT_VECTOR3", Trade::AnimationTrackType::BitVector3)
+        .value("BIT_VECTOR4", Trade::AnimationTrackType::BitVector4)
+        .value("VECTOR2", Trade::AnimationTrackType::Vector2)
+        .value("VECTOR2UI", Trade::AnimationTrackType::Vector2ui)
+        .value("VECTOR2I", Trade::AnimationTrackType::Vector2i)
+        .value("VECTOR3", Trade::AnimationTrackType::Vector3)
+        .value("VECTOR3UI", Trade::AnimationTrackType::Vector3ui)
+        .value("VECTOR3I", Trade::AnimationTrackType::Vector3i)
+        .value("VECTOR4", Trade::AnimationTrackType::Vector4)
+        .value("VECTOR4UI", Trade::AnimationTrackType::Vector4ui)
+        .value("VECTOR4I", Trade::AnimationTrackType::Vector4i)
+        .value("COMPLEX", Trade::AnimationTrackType::Complex)
+        .value("QUATERNION", Trade::AnimationTrackType::Quaternion)
+        .value("DUAL_QUATERNION", Trade::AnimationTrackType::DualQuaternion)
+        .value("CUBIC_HERMITE1D", Trade::AnimationTrackType::CubicHermite1D)
+        .value("CUBIC_HERMITE2D", Trade::AnimationTrackType::CubicHermite2D)
+        .value("CUBIC_HERMITE3D", Trade::AnimationTrackType::CubicHermite3D)
+        .value("CUBIC_HERMITE_COMPLEX", Trade::AnimationTrackType::CubicHermiteComplex)
+        .value("CUBIC_HERMITE_QUATERNION", Trade::AnimationTrackType::CubicHermiteQuaternion);
+
+    py::enum_<Trade::AnimationTrackTarget> animationTrackTarget{m, "AnimationTrackTarget", "Target of an animation track"};
+    animationTrackTarget
+        .value("TRANSLATION2D", Trade::AnimationTrackTarget::Translation2D)
+        .value("TRANSLATION3D", Trade::AnimationTrackTarget::Translation3D)
+        .value("ROTATION2D", Trade::AnimationTrackTarget::Rotation2D)
+        .value("ROTATION3D", Trade::AnimationTrackTarget::Rotation3D)
+        .value("SCALING2D", Trade::AnimationTrackTarget::Scaling2D)
+        .value("SCALING3D", Trade::AnimationTrackTarget::Scaling3D);
+    enumWithCustomValues<Trade::AnimationTrackTarget, Trade::Implementation::AnimationTrackTargetCustom>(animationTrackTarget);
+
+    py::class_<Trade::AnimationData, Trade::PyDataHolder<Trade::AnimationData>>{m, "AnimationData", "Animation clip data"}
+        .def_property_readonly("data_flags", [](const Trade::AnimationData& self) {
+            return Trade::DataFlag(Containers::enumCastUnderlyingType(self.dataFlags()));
+        }, "Data flags")
+        .def_property_readonly("duration", &Trade::AnimationData::duration, "Duration")
+        .def_property_readonly("track_count", &Trade::AnimationData::trackCount, "Track count")
+        .def("track_type", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.trackType(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track value type", py::arg("id"))
+        .def("track_result_type", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.trackResultType(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track result type", py::arg("id"))
+        .def("track_target_name", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.trackTargetName(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track target name", py::arg("id"))
+        .def("track_target", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.trackTarget(id);
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track target object", py::arg("id"))
+        .def("track_interpolation", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.track(id).interpolation();
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track interpolation type", py::arg("id"))
+        .def("track_before", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.track(id).before();
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track extrapolation behavior before first keyframe", py::arg("id"))
+        .def("track_after", [](const Trade::AnimationData& self, UnsignedInt id) {
+            if(id < self.trackCount())
+                return self.track(id).after();
+
+            PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+            throw py::error_already_set{};
+        }, "Track extrapolation behavior after last keyframe", py::arg("id"))
+        .def("track_keys", [](/*const*/ Trade::AnimationData& self, UnsignedInt id) {
+            if(id >= self.trackCount()) {
+                PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+                throw py::error_already_set{};
+            }
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, const char>{self.track(id).keys()}, py::cast(self));
+        }, "Track keyframe times", py::arg("id"))
+        .def("track_values", [](/*const*/ Trade::AnimationData& self, UnsignedInt id) {
+            if(id >= self.trackCount()) {
+                PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+                throw py::error_already_set{};
+            }
+            /** @todo annotate the return type properly in the docs */
+            return animationTrackValuesView<const char>(const_cast<const Trade::AnimationData&>(self), id, py::cast(self));
+        }, "Track keyframe values", py::arg("id"))
+        .def("mutable_track_keys", [](Trade::AnimationData& self, UnsignedInt id) {
+            if(id >= self.trackCount()) {
+                PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+                throw py::error_already_set{};
+            }
+            if(!(self.dataFlags() & Trade::DataFlag::Mutable)) {
+                PyErr_SetString(PyExc_AttributeError, "animation data is not mutable");
+                throw py::error_already_set{};
+            }
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<1, char>{self.mutableTrack(id).keys()}, py::cast(self));
+        }, "Mutable track keyframe times", py::arg("id"))
+        .def("mutable_track_values", [](Trade::AnimationData& self, UnsignedInt id) {
+            if(id >= self.trackCount()) {
+                PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+                throw py::error_already_set{};
+            }
+            if(!(self.dataFlags() & Trade::DataFlag::Mutable)) {
+                PyErr_SetString(PyExc_AttributeError, "animation data is not mutable");
+                throw py::error_already_set{};
+            }
+            /** @todo annotate the return type properly in the docs */
+            return animationTrackValuesView<char>(self, id, py::cast(self));
+        }, "Mutable track keyframe values", py::arg("id"))
+
+        /* Sampling. The track keys and values are referenced directly, with
+           the whole loop running without the GIL. */
+        .def("sample", [](const Trade::AnimationData& self, UnsignedInt id, const Containers::PyStridedArrayView<1, const char>& times) {
+            if(id >= self.trackCount()) {
+                PyErr_Format(PyExc_IndexError, "index %u out of range for %u tracks", id, self.trackCount());
+                throw py::error_already_set{};
+            }
+            const Containers::Pair<UnsignedInt, AnimationTrackSampler> sampler = animationTrackSampler(self, id);
+            const Containers::StridedArrayView1D<const Float> timesView = animationSampleTimes(times);
+
+            Containers::Array<Float> out{NoInit, timesView.size()*sampler.first()};
+            const Containers::StridedArrayView2D<Float> outView{out, {timesView.size(), sampler.first()}};
+            {
+                py::gil_scoped_release release;
+                sampler.second()(self, id, timesView, outView);
+            }
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<2, char>{outView}, Containers::pyArrayOwner(std::move(out)));
+        }, "Sample a track at given times", py::arg("id"), py::arg("times"))
+        .def("sample", [](const Trade::AnimationData& self, const std::vector<UnsignedInt>& ids, const Containers::PyStridedArrayView<1, const char>& times) {
+            UnsignedInt components;
+            const Containers::Array<AnimationTrackSampler> samplers = animationTrackSamplers(self, ids, components);
+            const Containers::StridedArrayView1D<const Float> timesView = animationSampleTimes(times);
+
+            Containers::Array<Float> out{NoInit, ids.size()*timesView.size()*components};
+            const Containers::StridedArrayView3D<Float> outView{out, {ids.size(), timesView.size(), components}};
+            sampleAnimationTracks(self, ids, samplers, timesView, outView);
+            return Containers::pyArrayViewHolder(Containers::PyStridedArrayView<3, char>{outView}, Containers::pyArrayOwner(std::move(out)));
+        }, "Sample multiple tracks at given times", py::arg("ids"), py::arg("times"))
+        .def("sample_into", [](const Trade::AnimationData& self, const std::vector<UnsignedInt>& ids, const Containers::PyStridedArrayView<1, const char>& times, const Containers::PyStridedArrayView<3, char>& dst) {
+            UnsignedInt components;
+            const Containers::Array<AnimationTrackSampler> samplers = animationTrackSamplers(self, ids, components);
+            const Containers::StridedArrayView1D<const Float> timesView = animationSampleTimes(times);
+
+            if(dst.itemsize != sizeof(Float) || Containers::StringView{dst.format} != Containers::StringView{"f"}) {
+                PyErr_Format(PyExc_AssertionError, "expected dst to be a view of 32-bit floats, got %s", dst.format ? dst.format.data() : "B");
+                throw py::error_already_set{};
+            }
+            if(dst.size() != Containers::Size3D{ids.size(), timesView.size(), components}) {
+                PyErr_Format(PyExc_AssertionError, "expected dst to have a size of (%zu, %zu, %u), got (%zu, %zu, %zu)", ids.size(), timesView.size(), components, dst.size()[0], dst.size()[1], dst.size()[2]);
+                throw py::error_already_set{};
+            }
+
+            sampleAnimationTracks(self, ids, samplers, timesView, Containers::arrayCast<Float>(dst));
+        }, "Sample multiple tracks at given times into an existing view", py::arg("ids"), py::arg("times"), py::arg("dst"))
+
+        .def_property_readonly("owner", [](Trade::AnimationData& self) {
+            return pyObjectHolderFor<Trade::PyDataHolder>(self).owner;
+        }, "Memory owner");
+
     py::enum_<Trade::TextureType>{m, "TextureType", "Texture type"}
         .value("TEXTURE1D", Trade::TextureType::Texture1D)
         .value("TEXTURE1D_ARRAY", Trade::TextureType::Texture1DArray)
@@ -3010,42 +4149,139 @@ void trade(py::module_& m) {
         .def_property("flags", [](Trade::AbstractImporter& self) {
             return Trade::ImporterFlag(Containers::enumCastUnderlyingType(self.flags()));
         }, [](Trade::AbstractImporter& self, Trade::ImporterFlag flags) {
+            checkNotBusy(self);
             self.setFlags(flags);
         }, "Importer flags")
-        .def_property_readonly("is_opened", &Trade::AbstractImporter::isOpened, "Whether any file is opened")
-        .def("open_data", [](Trade::AbstractImporter& self, Containers::ArrayView<const char> data) {
+        .def_property_readonly("is_opened", [](Trade::AbstractImporter& self) {
+            checkNotBusy(self);
+            return self.isOpened();
+        }, "Whether any file is opened")
+        .def("open_data", [](Trade::AbstractImporter& self, const Containers::ArrayView<const char>& data, bool borrow) {
+            checkNotBusy(self);
             if(!(self.features() >= Trade::ImporterFeature::OpenData)) {
                 PyErr_SetString(PyExc_AssertionError, "feature not supported");
                 throw py::error_already_set{};
             }
 
-            /** @todo log redirection -- but we'd need assertions to not be
-                part of that so when it dies, the user can still see why */
-            if(self.openData(data))
+            importerClose(self);
+
+            /* The buffer `data` points to is kept alive by the caller for the
+               whole duration of the call, so it's fine to release the GIL */
+            bool out;
+            {
+                ImporterBusyScope busy{self};
+                py::gil_scoped_release release;
+                /** @todo log redirection -- but we'd need assertions to not
+                    be part of that so when it dies, the user can still see
+                    why */
+                /* When borrowing, the importer doesn't need to make a copy
+                   and the imported data can reference the memory as well */
+                out = borrow ? self.openMemory(data) : self.openData(data);
+            }
+            if(out) {
+                /* Keep the object owning the memory alive for as long as the
+                   importer or any data referencing the memory need it */
+                if(borrow) {
+                    py::object owner = pyObjectHolderFor<Containers::PyArrayViewHolder>(data).owner;
+                    if(!owner.is_none())
+                        pyObjectHolderFor<PluginManager::PyPluginHolder>(self).memoryOwner = std::move(owner);
+                }
                 return;
+            }
 
             PyErr_SetString(PyExc_RuntimeError, "opening data failed");
             throw py::error_already_set{};
-        }, "Open raw data", py::arg("data"))
+        }, "Open raw data", py::arg("data"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("borrow") = false)
         /** @todo drop std::string in favor of our own string caster */
-        .def("open_file", [](Trade::AbstractImporter& self, const std::string& filename) {
-            /** @todo log redirection -- but we'd need assertions to not be
-                part of that so when it dies, the user can still see why */
-            if(self.openFile(
-                #ifdef CORRADE_TARGET_WINDOWS
-                /* To allow people to conveniently use Python's os.path, we
-                   need to convert backslashes to forward slashes as all
-                   Corrade and Magnum APIs expect forward */
-                Utility::Path::fromNativeSeparators(filename)
+        .def("open_file", [](Trade::AbstractImporter& self, const std::string& filename, bool mmap) {
+            checkNotBusy(self);
+            importerClose(self);
+
+            if(mmap) {
+                #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+                if(!(self.features() >= Trade::ImporterFeature::OpenData)) {
+                    PyErr_SetString(PyExc_AssertionError, "feature not supported");
+                    throw py::error_already_set{};
+                }
+
+                Containers::Pointer<ImporterFileMapping> mapping{InPlaceInit};
+                bool out = false;
+                {
+                    ImporterBusyScope busy{self};
+                    py::gil_scoped_release release;
+                    #ifdef CORRADE_TARGET_WINDOWS
+                    const Containers::String path = Utility::Path::fromNativeSeparators(filename);
+                    #else
+                    const Containers::StringView path = filename;
+                    #endif
+                    if(Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> file = Utility::Path::mapRead(path)) {
+                        mapping->directory = Utility::Path::split(path).first();
+                        mapping->file = *std::move(file);
+                        /* Files referenced from the opened one get mapped
+                           through the callback as well, it also makes it
+                           possible to open files with external references
+                           from memory in the first place */
+                        self.setFileCallback(importerFileMappingCallback, mapping.get());
+                        /** @todo log redirection -- but we'd need assertions
+                            to not be part of that so when it dies, the user
+                            can still see why */
+                        out = self.openMemory(mapping->file);
+                    }
+                }
+                if(!out) {
+                    self.setFileCallback(nullptr);
+                    PyErr_Format(PyExc_RuntimeError, "opening %s failed", filename.data());
+                    throw py::error_already_set{};
+                }
+
+                /* The mapping is released once the importer is closed and all
+                   data referencing it are destroyed */
+                pyObjectHolderFor<PluginManager::PyPluginHolder>(self).memoryOwner = py::capsule{mapping.release(), [](void* mapping) {
+                    delete static_cast<ImporterFileMapping*>(mapping);
+                }};
+                return;
                 #else
-                filename
+                PyErr_SetString(PyExc_NotImplementedError, "memory-mapped files are not available on this platform");
+                throw py::error_already_set{};
                 #endif
-            )) return;
+            }
+
+            bool out;
+            {
+                ImporterBusyScope busy{self};
+                py::gil_scoped_release release;
+                /** @todo log redirection -- but we'd need assertions to not
+                    be part of that so when it dies, the user can still see
+                    why */
+                out = self.openFile(
+                    #ifdef CORRADE_TARGET_WINDOWS
+                    /* To allow people to conveniently use Python's os.path,
+                       we need to convert backslashes to forward slashes as
+                       all Corrade and Magnum APIs expect forward */
+                    Utility::Path::fromNativeSeparators(filename)
+                    #else
+                    filename
+                    #endif
+                );
+            }
+            if(out)
+                return;
 
             PyErr_Format(PyExc_RuntimeError, "opening %s failed", filename.data());
             throw py::error_already_set{};
-        }, "Open a file", py::arg("filename"))
-        .def("close", &Trade::AbstractImporter::close, "Close currently opened file")
+        }, "Open a file", py::arg("filename"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("mmap") = false)
+        .def("close", [](Trade::AbstractImporter& self) {
+            checkNotBusy(self);
+            importerClose(self);
+        }, "Close currently opened file")
 
         .def_property_readonly("default_scene", checkOpened<Int, &Trade::AbstractImporter::defaultScene>, "Default scene")
         .def_property_readonly("scene_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::sceneCount>, "Scene count")
@@ -3058,6 +4294,7 @@ void trade(py::module_& m) {
         .def("scene", checkOpenedBoundsResultString<Trade::SceneData, &Trade::AbstractImporter::scene, &Trade::AbstractImporter::sceneForName, &Trade::AbstractImporter::sceneCount>, "Scene for given name", py::arg("name"))
         /** @todo drop std::string in favor of our own string caster */
         .def("scene_field_for_name", [](Trade::AbstractImporter& self, const std::string& name) -> Containers::Optional<Trade::SceneField> {
+            checkNotBusy(self);
             const Trade::SceneField field = self.sceneFieldForName(name);
             if(field == Trade::SceneField{})
                 return {};
@@ -3065,11 +4302,18 @@ void trade(py::module_& m) {
         }, "Scene field for given name", py::arg("name"))
         /** @todo drop std::string in favor of our own string caster */
         .def("scene_field_name", [](Trade::AbstractImporter& self, Trade::SceneField name) -> Containers::Optional<std::string> {
+            checkNotBusy(self);
             if(const Containers::String field = self.sceneFieldName(name))
                 return std::string{field};
             return {};
         }, "String name for given custom scene field", py::arg("name"))
 
+        .def_property_readonly("animation_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::animationCount>, "Animation count")
+        .def("animation_for_name", checkOpenedString<Int, &Trade::AbstractImporter::animationForName>, "Animation ID for given name", py::arg("name"))
+        .def("animation_name", checkOpenedBoundsReturnsString<UnsignedInt, &Trade::AbstractImporter::animationName, &Trade::AbstractImporter::animationCount>, "Animation name", py::arg("id"))
+        .def("animation", checkOpenedBoundsResult<Trade::AnimationData, &Trade::AbstractImporter::animation, &Trade::AbstractImporter::animationCount>, "Animation", py::arg("id"))
+        .def("animation", checkOpenedBoundsResultString<Trade::AnimationData, &Trade::AbstractImporter::animation, &Trade::AbstractImporter::animationForName, &Trade::AbstractImporter::animationCount>, "Animation for given name", py::arg("name"))
+
         /** @todo all other data types */
         .def_property_readonly("mesh_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::meshCount>, "Mesh count")
         .def("mesh_level_count", checkOpenedBounds<UnsignedInt, &Trade::AbstractImporter::meshLevelCount, &Trade::AbstractImporter::meshCount>, "Mesh level count", py::arg("id"))
@@ -3077,8 +4321,10 @@ void trade(py::module_& m) {
         .def("mesh_name", checkOpenedBoundsReturnsString<UnsignedInt, &Trade::AbstractImporter::meshName, &Trade::AbstractImporter::meshCount>, "Mesh name", py::arg("id"))
         .def("mesh", checkOpenedBoundsResult<Trade::MeshData, &Trade::AbstractImporter::mesh, &Trade::AbstractImporter::meshCount, &Trade::AbstractImporter::meshLevelCount>, "Mesh", py::arg("id"), py::arg("level") = 0)
         .def("mesh", checkOpenedBoundsResultString<Trade::MeshData, &Trade::AbstractImporter::mesh, &Trade::AbstractImporter::meshForName, &Trade::AbstractImporter::meshCount, &Trade::AbstractImporter::meshLevelCount>, "Mesh for given name", py::arg("name"), py::arg("level") = 0)
+        .def("meshes", checkOpenedBoundsResults<Trade::MeshData, &Trade::AbstractImporter::mesh, &Trade::AbstractImporter::meshCount, &Trade::AbstractImporter::meshLevelCount>, "Import multiple meshes at once", py::arg("ids") = py::none(), py::arg("level") = 0)
         /** @todo drop std::string in favor of our own string caster */
         .def("mesh_attribute_for_name", [](Trade::AbstractImporter& self, const std::string& name) -> Containers::Optional<Trade::MeshAttribute> {
+            checkNotBusy(self);
             const Trade::MeshAttribute attribute = self.meshAttributeForName(name);
             if(attribute == Trade::MeshAttribute{})
                 return {};
@@ -3086,6 +4332,7 @@ void trade(py::module_& m) {
         }, "Mesh attribute for given name", py::arg("name"))
         /** @todo drop std::string in favor of our own string caster */
         .def("mesh_attribute_name", [](Trade::AbstractImporter& self, Trade::MeshAttribute name) -> Containers::Optional<std::string> {
+            checkNotBusy(self);
             if(const Containers::String attribute = self.meshAttributeName(name))
                 return std::string{attribute};
             return {};
@@ -3097,6 +4344,7 @@ void trade(py::module_& m) {
         .def("material", [](Trade::AbstractImporter& self, const UnsignedInt id) {
             /** @todo drop in favor of the generic helper once the
                 OptionalButAlsoPointer backwards compatibility helper is gone */
+            checkNotBusy(self);
             if(!self.isOpened()) {
                 PyErr_SetString(PyExc_AssertionError, "no file opened");
                 throw py::error_already_set{};
@@ -3107,18 +4355,24 @@ void trade(py::module_& m) {
                 throw py::error_already_set{};
             }
 
-            Containers::Optional<Trade::MaterialData> out = self.material(id);
+            Containers::Optional<Trade::MaterialData> out;
+            {
+                ImporterBusyScope busy{self};
+                py::gil_scoped_release release;
+                out = self.material(id);
+            }
             if(!out) {
                 PyErr_SetString(PyExc_RuntimeError, "import failed");
                 throw py::error_already_set{};
             }
 
-            return *std::move(out);
+            return ImporterData<Trade::MaterialData>::wrap(self, *std::move(out));
         }, "Material", py::arg("id"))
         /** @todo drop std::string in favor of our own string caster */
         .def("material", [](Trade::AbstractImporter& self, const std::string& name) {
             /** @todo drop in favor of the generic helper once the
                 OptionalButAlsoPointer backwards compatibility helper is gone */
+            checkNotBusy(self);
             if(!self.isOpened()) {
                 PyErr_SetString(PyExc_AssertionError, "no file opened");
                 throw py::error_already_set{};
@@ -3134,14 +4388,27 @@ void trade(py::module_& m) {
 
             /** @todo log redirection -- but we'd need assertions to not be
                 part of that so when it dies, the user can still see why */
-            Containers::Optional<Trade::MaterialData> out = self.material(id);
+            Containers::Optional<Trade::MaterialData> out;
+            {
+                ImporterBusyScope busy{self};
+                py::gil_scoped_release release;
+                out = self.material(id);
+            }
             if(!out) {
                 PyErr_SetString(PyExc_RuntimeError, "import failed");
                 throw py::error_already_set{};
             }
 
-            return *std::move(out);
+            return ImporterData<Trade::MaterialData>::wrap(self, *std::move(out));
         }, "Material for given name", py::arg("name"))
+        .def("materials", [](Trade::AbstractImporter& self, const Containers::Optional<std::vector<UnsignedInt>>& ids) {
+            const Containers::Array<UnsignedInt> idsToImport = checkOpenedBoundsIds(self, ids, &Trade::AbstractImporter::materialCount);
+            /** @todo drop the explicit return type once the
+                OptionalButAlsoPointer backwards compatibility helper is gone */
+            return importResults<Trade::MaterialData>(self, idsToImport, [&self](UnsignedInt id) -> Containers::Optional<Trade::MaterialData> {
+                return self.material(id);
+            });
+        }, "Import multiple materials at once", py::arg("ids") = py::none())
 
         .def_property_readonly("texture_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::textureCount>, "Texture count")
         .def("texture_for_name", checkOpenedString<Int, &Trade::AbstractImporter::textureForName>, "Texture ID for given name", py::arg("name"))
@@ -3166,11 +4433,45 @@ void trade(py::module_& m) {
         .def("image2d", checkOpenedBoundsResult<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount, &Trade::AbstractImporter::image2DLevelCount>, "Two-dimensional image", py::arg("id"), py::arg("level") = 0)
         .def("image2d", checkOpenedBoundsResultString<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DForName, &Trade::AbstractImporter::image2DCount, &Trade::AbstractImporter::image2DLevelCount>, "Two-dimensional image for given name", py::arg("name"), py::arg("level") = 0)
         .def("image3d", checkOpenedBoundsResult<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount, &Trade::AbstractImporter::image3DLevelCount>, "Three-dimensional image", py::arg("id"), py::arg("level") = 0)
-        .def("image3d", checkOpenedBoundsResultString<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DForName, &Trade::AbstractImporter::image3DCount, &Trade::AbstractImporter::image3DLevelCount>, "Threee-dimensional image for given name", py::arg("name"), py::arg("level") = 0);
+        .def("image3d", checkOpenedBoundsResultString<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DForName, &Trade::AbstractImporter::image3DCount, &Trade::AbstractImporter::image3DLevelCount>, "Threee-dimensional image for given name", py::arg("name"), py::arg("level") = 0)
+        .def("images1d", checkOpenedBoundsResults<Trade::ImageData1D, &Trade::AbstractImporter::image1D, &Trade::AbstractImporter::image1DCount, &Trade::AbstractImporter::image1DLevelCount>, "Import multiple one-dimensional images at once", py::arg("ids") = py::none(), py::arg("level") = 0)
+        .def("images2d", checkOpenedBoundsResults<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount, &Trade::AbstractImporter::image2DLevelCount>, "Import multiple two-dimensional images at once", py::arg("ids") = py::none(), py::arg("level") = 0)
+        .def("images3d", checkOpenedBoundsResults<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount, &Trade::AbstractImporter::image3DLevelCount>, "Import multiple three-dimensional images at once", py::arg("ids") = py::none(), py::arg("level") = 0);
 
     py::class_<PluginManager::Manager<Trade::AbstractImporter>, PluginManager::AbstractManager> importerManager{m, "ImporterManager", "Manager for importer plugins"};
     corrade::manager(importerManager);
 
+    /* Import pool */
+    py::class_<ImportPool> importPool{m, "ImportPool", "Pool of importers for parallel import of multiple files"};
+    py::class_<ImportPoolIterator<Trade::MeshData>> importPoolMeshIterator{importPool, "MeshIterator", "Iterator over meshes imported by a pool"};
+    py::class_<ImportPoolIterator<Trade::ImageData2D>> importPoolImage2DIterator{importPool, "Image2DIterator", "Iterator over two-dimensional images imported by a pool"};
+    py::class_<ImportPoolIterator<Trade::SceneData>> importPoolSceneIterator{importPool, "SceneIterator", "Iterator over scenes imported by a pool"};
+    importPoolIterator(importPoolMeshIterator);
+    importPoolIterator(importPoolImage2DIterator);
+    importPoolIterator(importPoolSceneIterator);
+    importPool
+        .def(py::init(&createImportPool), "Constructor", py::arg("manager"), py::arg("plugin"),
+            #if PYBIND11_VERSION_MAJOR*100 + PYBIND11_VERSION_MINOR >= 206
+            py::kw_only{}, /* new in pybind11 2.6 */
+            #endif
+            py::arg("thread_count") = 0)
+        .def_property_readonly("thread_count", [](ImportPool& self) {
+            return UnsignedInt(self.importers.size());
+        }, "Thread count")
+        .def("close", [](ImportPool& self) {
+            if(self.busy) {
+                PyErr_SetString(PyExc_RuntimeError, "the pool is importing");
+                throw py::error_already_set{};
+            }
+            self.importers = nullptr;
+            self.managers = nullptr;
+        }, "Close the pool and unload all plugins")
+        .def("meshes", importPoolImport<Trade::MeshData, importPoolMesh>, "Import meshes from multiple files", py::arg("filenames"), py::arg("id") = 0, py::arg("level") = 0)
+        .def("images2d", importPoolImport<Trade::ImageData2D, importPoolImage2D>, "Import two-dimensional images from multiple files", py::arg("filenames"), py::arg("id") = 0, py::arg("level") = 0)
+        .def("scenes", [](ImportPool& self, std::vector<std::string> filenames, UnsignedInt id) {
+            return importPoolImport<Trade::SceneData, importPoolScene>(self, std::move(filenames), id, 0);
+        }, "Import scenes from multiple files", py::arg("filenames"), py::arg("id") = 0);
+
     /* Image converter */
     py::enum_<Trade::ImageConverterFeature> imageConverterFeatures{m, "ImageConverterFeatures", "Features supported by an image converter"};
     imageConverterFeatures
@@ -3300,6 +4601,7 @@ void trade(py::module_& m) {
         .value("NAMES", Trade::SceneContent::Names)
         .value("ALL", Trade::SceneContent(Containers::enumCastUnderlyingType(~Trade::SceneContent{})))
         .def("FOR", [](Trade::AbstractImporter& importer) {
+            checkNotBusy(importer);
             if(!importer.isOpened()) {
                 PyErr_SetString(PyExc_AssertionError, "no file opened");
                 throw py::error_already_set{};
@@ -3574,6 +4876,7 @@ void trade(py::module_& m) {
                 PyErr_SetString(PyExc_AssertionError, "no conversion in progress");
                 throw py::error_already_set{};
             }
+            checkNotBusy(importer);
             if(!importer.isOpened()) {
                 PyErr_SetString(PyExc_AssertionError, "the importer is not opened");
                 throw py::error_already_set{};
@@ -3590,6 +4893,7 @@ void trade(py::module_& m) {
                 PyErr_SetString(PyExc_AssertionError, "no conversion in progress");
                 throw py::error_already_set{};
             }
+            checkNotBusy(importer);
             if(!importer.isOpened()) {
                 PyErr_SetString(PyExc_AssertionError, "the importer is not opened");
                 throw py::error_already_set{};
@@ -39,6 +39,7 @@ extension_paths = {
     'corrade.pluginmanager': '${corrade_pluginmanager_file}',
     'corrade.utility': '${corrade_utility_file}',
     '_magnum': '$<TARGET_FILE:magnum>',
+    'magnum.debugtools': '${magnum_debugtools_file}',
     'magnum.gl': '${magnum_gl_file}',
     'magnum.materialtools': '${magnum_materialtools_file}',
     'magnum.meshtools': '${magnum_meshtools_file}',